@@ -1,23 +1,37 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
+#include <utility>
 #include "utility.hpp"
+#include "type_traits.hpp"
 #include "bidirectional_iterator.hpp"
+#include "pool_allocator.hpp"
+#include "stats.hpp"
+#include "tree_policy.hpp"
 
-template< class T, class f_object, class Compare, class Allocator = std::allocator<Node<T> > >
+template< class T, class f_object, class Compare, class Allocator = ft::pool_allocator<Node<T> >,
+    class Augment = ft::no_augment >
 class RBT
 { 
 private:
-        
+    typedef typename Augment::template node<T>::type                node_type;
+    typedef typename Allocator::template rebind<node_type>::other   node_allocator;
+
     size_t _size;
     Compare compare;
     f_object access;
-    Node<T>* root;
-    Allocator alloc;
-    Node<T>* NIL;
+    rb_node_base* root;
+    rb_node_base* leftmost;
+    rb_node_base* rightmost;
+    node_allocator alloc;
+    mutable rb_node_base header;
+#ifdef FT_STATS
+    mutable ft::container_stats _stats;
+#endif
 
 public:
-    typedef Node<T>*                                NodePtr;
+    typedef rb_node_base*                           NodePtr;
     typedef typename f_object::key_type              key_type;
     typedef ft::bidirectional_iterator<T>           iterator;
     typedef ft::bidirectional_const_iterator<T>     const_iterator;
@@ -25,10 +39,7 @@ public:
 
     RBT(Compare compare = Compare())
     {
-        makeNil();
-        root = NIL;
-        NIL->p = root;
-        _size = 0;
+        init_header();
         this->compare = compare;
     }
    
@@ -38,58 +49,48 @@ public:
         if (this == &other)
             return *this;
         delete_all();
-        delete_NIL();
-        iterator it(other.minimum());
-        makeNil();
-        root = NIL;
-        NIL->p = root;
-        _size = 0;
         this->compare = other.compare;
-        for (size_t i = 0; i < other._size; ++i, ++it)
-            this->insert(*it);
+        copy_tree(other);
         return *this;
     }
 
     RBT(const RBT &other)
     {
-        iterator it(other.minimum());
-        makeNil();
-        root = NIL;
-        NIL->p = root;
-        _size = 0;
+        init_header();
         this->compare = other.compare;
-        for (size_t i = 0; i < other._size; ++i, ++it)
-            this->insert(*it);
+        copy_tree(other);
     }
 
+#if __cplusplus >= 201103L
+    RBT(RBT &&other)
+    {
+        init_header();
+        this->compare = other.compare;
+        swap(other);
+    }
+
+    RBT &operator=(RBT &&other)
+    {
+        if (this == &other)
+            return *this;
+        delete_all();
+        swap(other);
+        return *this;
+    }
+#endif
+
     NodePtr successor(NodePtr n)
     {
-        if (!n)
-    		return n;
-        if (!n->right->is_nil)
-        {
-            n = n->right;
-            while (!n->left->is_nil)
-    			n = n->left;
-        }
-        else if (!n->p->is_nil && n == n->p->left)
-            n = n->p;
-        else
-        {
-            while (!n->p->is_nil && n == n->p->right)
-    			n = n->p;
-            n = n->p;
-        }
-        return n;
+        return increment(n);
     }
 
     NodePtr  lower_bound(key_type key) const
     {
         NodePtr x = root;
-        NodePtr y = NIL;
-        while (x != NIL)
+        NodePtr y = &header;
+        while (x != nil())
         {
-            if (!compare(access(x->key), key))
+            if (!key_less(access(value(x)), key))
             {
                 y = x;
                 x = x->left;
@@ -103,10 +104,10 @@ public:
     NodePtr  upper_bound(const key_type key) const
     {
         NodePtr x = root;
-        NodePtr y = NIL;
-        while (x != NIL)
+        NodePtr y = &header;
+        while (x != nil())
         {
-            if (compare(key, access(x->key)))
+            if (key_less(key, access(value(x))))
             {
                 y = x;
                 x = x->left;
@@ -117,20 +118,14 @@ public:
         return y;
     }
 
-    void delete_NIL()
-    {
-        alloc.destroy(NIL);
-        alloc.deallocate(NIL, 1);
-    }
-    
     NodePtr minimum() const
     {
-        return min_helper(root);
+        return leftmost;
     }
 
     NodePtr maximum() const
     {
-        return max_helper(root);
+        return rightmost;
     }
 
     size_t size() const
@@ -140,98 +135,148 @@ public:
 
     NodePtr predecessor(NodePtr n)
     {
-        if (!n)
-        	return n;
-        if (!n->left->is_nil)
-        {
-            n = n->left;
-            while (!n->right->is_nil)
-        		n = n->right;
-        }
-        else if (!n->p->is_nil && n == n->p->right)
-            n = n->p;
-        else
-        {
-            while (!n->p->is_nil && n == n->p->left)
-        		n = n->p;
-            n = n->p;
-        }
-        return n;
+        return decrement(n);
     }
  
 
     NodePtr   search(key_type key) const
     {
-        NodePtr tmp = search_helper(key, root);
-        return tmp;
+        NodePtr parent;
+        bool left;
+        return find_insert_position(key, parent, left);
     }
 
-    NodePtr insert(T elem)
+    // Single descent: returns the node holding a key equivalent to key, or
+    // the header with parent and left set to where such a node would be
+    // attached.
+    NodePtr find_insert_position(const key_type& key, NodePtr& parent, bool& left) const
     {
-        NodePtr z;
-        Node<T> tmp (elem);
-        try
+        NodePtr x = root;
+        NodePtr candidate = nil();
+        parent = &header;
+        left = true;
+        while (x != nil())
         {
-            z = alloc.allocate(1);
+            parent = x;
+            left = key_less(key, access(value(x)));
+            if (left)
+                x = x->left;
+            else
+            {
+                candidate = x;
+                x = x->right;
+            }
         }
-        catch (const std::bad_alloc& e)
-        {
-            std::cerr << "Allocation failed: " << e.what() << '\n';
-            delete_all();
-            delete_NIL();
-            _size = 0;
+        if (candidate != nil() && !key_less(access(value(candidate)), key))
+            return candidate;
+        return &header;
+    }
 
-        }
-        alloc.construct(z, tmp);
-        return insert_helper(z, root);                                                                                                         
+    // Allocates only when the key is not present yet.
+    ft::pair<NodePtr, bool> insert_unique(const T& elem)
+    {
+        NodePtr parent;
+        bool left;
+        NodePtr found = find_insert_position(access(elem), parent, left);
+        if (found != &header)
+            return ft::make_pair(found, false);
+        return ft::make_pair(insert_at(parent, left, elem), true);
     }
 
-    NodePtr insert(iterator pos, T elem)
+#if __cplusplus >= 201103L
+    ft::pair<NodePtr, bool> insert_unique(T&& elem)
     {
-        NodePtr z;
-        Node<T> tmp (elem);
-        try
+        NodePtr parent;
+        bool left;
+        NodePtr found = find_insert_position(access(elem), parent, left);
+        if (found != &header)
+            return ft::make_pair(found, false);
+        return ft::make_pair(insert_at(parent, left, std::move(elem)), true);
+    }
+
+    // Inserts at a position returned by find_insert_position, constructing
+    // the element in place from args.
+    template <class... Args>
+    NodePtr insert_at(NodePtr parent, bool left, Args&&... args)
+    {
+        return attach(create_node(std::forward<Args>(args)...), parent, left);
+    }
+
+    // The key is only known once the node is built, so a duplicate costs
+    // an allocation.
+    template <class... Args>
+    ft::pair<NodePtr, bool> emplace_unique(Args&&... args)
+    {
+        NodePtr z = create_node(std::forward<Args>(args)...);
+        NodePtr parent;
+        bool left;
+        NodePtr found = find_insert_position(access(value(z)), parent, left);
+        if (found != &header)
         {
-            z = alloc.allocate(1);
+            destroy_node(z);
+            return ft::make_pair(found, false);
         }
-        catch (const std::bad_alloc& e)
+        return ft::make_pair(attach(z, parent, left), true);
+    }
+
+    template <class... Args>
+    NodePtr emplace_hint_unique(NodePtr hint, Args&&... args)
+    {
+        NodePtr z = create_node(std::forward<Args>(args)...);
+        NodePtr parent;
+        bool left;
+        NodePtr found = hint_position(hint, access(value(z)), parent, left);
+        if (found != &header)
         {
-            std::cerr << "Allocation failed: " << e.what() << '\n';
-            delete_all();
-            delete_NIL();
-            _size = 0;
+            destroy_node(z);
+            return found;
         }
-        alloc.construct(z, tmp);
-        (void)pos;
-        return insert_helper(z, root);                                                                                                         
+        return attach(z, parent, left);
+    }
+#else
+    // Inserts at a position returned by find_insert_position.
+    NodePtr insert_at(NodePtr parent, bool left, const T& elem)
+    {
+        return attach(create_node(elem), parent, left);
+    }
+#endif
+
+    NodePtr insert(T elem)
+    {
+        return insert_helper(create_node(elem), root);
+    }
+
+    // Unique insertion of a range. Into an empty tree, input that is
+    // already sorted is linked into a balanced tree in O(n); anything after
+    // the first out-of-order element falls back to hinted insertion.
+    template <class InputIt>
+    void insert_range(InputIt first, InputIt last)
+    {
+        if (_size == 0)
+            build_sorted(first, last);
+        for (; first != last; ++first)
+            insert_hint(&header, *first);
+    }
+
+    NodePtr insert(iterator pos, T elem)
+    {
+        return insert_hint(pos.base(), elem);
     }
 
     NodePtr insert(const_iterator pos, T elem)
     {
-        NodePtr z;
-        Node<T> tmp (elem);
-        try
-        {
-            z = alloc.allocate(1);
-        }
-        catch (const std::bad_alloc& e)
-        {
-            std::cerr << "Allocation failed: " << e.what() << '\n';
-            delete_all();
-            delete_NIL();
-            _size = 0;
-        }
-        alloc.construct(z, tmp);
-        (void)pos;
-        return insert_helper(z, root);                                                                                                         
+        return insert_hint(pos.base(), elem);
     }
 
 
     void delete_all()
     {
-        delete_helper(root);
-        root = NIL;
-        NIL->p = root;
+        if (!purge_nodes(ft::allocator_can_purge<node_allocator>()))
+            delete_helper(root);
+        root = nil();
+        leftmost = &header;
+        rightmost = &header;
+        header.set_parent(root);
         _size = 0;
     }
 
@@ -243,53 +288,148 @@ public:
     void remove(key_type key)
     {
         NodePtr z = search(key);
-        if (z == NIL)
-            return ;
+        if (z != &header)
+            erase_node(z);
+    }
+
+    // Removes [first, last) by walking successors; erasing everything
+    // from the leftmost node on is a plain teardown.
+    void erase_range(NodePtr first, NodePtr last)
+    {
+        if (first == leftmost && last == &header)
+        {
+            delete_all();
+            return;
+        }
+        while (first != last)
+        {
+            NodePtr next = successor(first);
+            erase_node(first);
+            first = next;
+        }
+    }
+
+    // The child that replaces the removed node may be the shared leaf
+    // sentinel, which is never written, so its parent is tracked apart.
+    void erase_node(NodePtr z)
+    {
+        if (z == leftmost)
+            leftmost = successor(z);
+        if (z == rightmost)
+            rightmost = predecessor(z);
         NodePtr y = z;
         NodePtr x;
-        char y_color = y->c;
-        if (z->left == NIL)
+        NodePtr x_parent;
+        bool y_black = y->is_black();
+        if (z->left == nil())
         {
             x = z->right;
+            x_parent = z->parent();
             transplant(z, z->right);
         }
-        else if(z->right == NIL)
+        else if(z->right == nil())
         {
             x = z->left;
+            x_parent = z->parent();
             transplant(z, z->left);
         }
         else
         {
             y = min_helper(z->right);
-            y_color = y->c;
+            y_black = y->is_black();
             x = y->right;
-            if (y->p == z)
-            {
-                x->p = y;
-            }
+            if (y->parent() == z)
+                x_parent = y;
             else
             {
+                x_parent = y->parent();
                 transplant(y, y->right);
                 y->right = z->right;
-                y->right->p = y;
+                y->right->set_parent(y);
             }
             transplant(z, y);
             y->left = z->left;
-            y->left->p = y;
-            y->c = z->c;
+            y->left->set_parent(y);
+            y->copy_color(z);
         }
-        if (y_color == 'B')
-            remove_fixup(x);
-        root->c = 'B';
+        update_path(x_parent);
+        if (y_black)
+            remove_fixup(x, x_parent);
+        if (root != nil())
+            root->set_black();
         _size--;
-        alloc.destroy(z);
-        alloc.deallocate(z, 1);
-        NIL->p = root;
+        destroy_node(z);
+        header.set_parent(root);
     }
 
-    void print2()
+    /*              Order statistics (ft::order_statistic)             */
+
+    // k-th smallest node, counting from 0; the header when k >= size().
+    NodePtr select(size_t k) const
     {
-        inorder(root);
+        NodePtr x = root;
+        while (x != nil())
+        {
+            size_t l = Augment::template count<T>(x->left);
+            if (k == l)
+                return x;
+            if (k < l)
+                x = x->left;
+            else
+            {
+                k -= l + 1;
+                x = x->right;
+            }
+        }
+        return &header;
+    }
+
+    // Number of keys less than key.
+    size_t rank(const key_type& key) const
+    {
+        size_t r = 0;
+        NodePtr x = root;
+        while (x != nil())
+        {
+            if (key_less(access(value(x)), key))
+            {
+                r += Augment::template count<T>(x->left) + 1;
+                x = x->right;
+            }
+            else
+                x = x->left;
+        }
+        return r;
+    }
+
+    // In-order position of n; size() for the header.
+    size_t index_of(NodePtr n) const
+    {
+        if (n == &header)
+            return _size;
+        size_t r = Augment::template count<T>(n->left);
+        for (; n->parent() != &header; n = n->parent())
+            if (n == n->parent()->right)
+                r += Augment::template count<T>(n->parent()->left) + 1;
+        return r;
+    }
+
+    /*              Aggregates (ft::aggregate_augment)              */
+
+    // Combines, in key order, the values of all elements with keys in
+    // [lo, hi) into acc. Whole subtrees inside the range are taken from
+    // their stored aggregate, so only the two boundary paths are walked.
+    template <class V>
+    void fold(const key_type& lo, const key_type& hi, V& acc) const
+    {
+        fold_helper(root, lo, hi, true, true, acc);
+    }
+
+    // Recomputes the augmented data above n after its element was
+    // modified in place.
+    void refresh(NodePtr n)
+    {
+        update_path(n);
     }
 
     void swap( RBT& other )
@@ -298,6 +438,14 @@ public:
         this->root = other.root;
         other.root = tmp_root;
 
+        NodePtr tmp_leftmost = this->leftmost;
+        this->leftmost = other.leftmost;
+        other.leftmost = tmp_leftmost;
+
+        NodePtr tmp_rightmost = this->rightmost;
+        this->rightmost = other.rightmost;
+        other.rightmost = tmp_rightmost;
+
         size_t tmp_size = this->_size;
         this->_size = other._size;
         other._size = tmp_size;
@@ -306,288 +454,655 @@ public:
         this->compare = other.compare;
         other.compare = tmp_compare;
 
-        NodePtr tmp_nil = this->NIL;
-        this->NIL = other.NIL;
-        other.NIL = tmp_nil;
+        node_allocator tmp_alloc = this->alloc;
+        this->alloc = other.alloc;
+        other.alloc = tmp_alloc;
 
+        this->relink_header();
+        other.relink_header();
     }
 
+    // Leaf sentinel, shared by all trees.
     NodePtr getNil() const
     {
-        return NIL;
+        return nil();
+    }
+
+    // Past-the-end node.
+    NodePtr getEnd() const
+    {
+        return &header;
+    }
+
+    static T& value(NodePtr n)
+    {
+        return static_cast<Node<T>*>(n)->key;
+    }
+
+    NodePtr getRoot() const
+    {
+        return root;
+    }
+
+    Compare key_comp() const
+    {
+        return compare;
+    }
+
+#ifdef FT_STATS
+    const ft::container_stats& stats() const
+    {
+        return _stats;
     }
+
+    void reset_stats()
+    {
+        _stats.reset();
+    }
+#endif
 private:
-    void makeNil()
+    static NodePtr nil()
+    {
+        return rb_nil();
+    }
+
+    bool key_less(const key_type& a, const key_type& b) const
+    {
+        FT_STAT(_stats, comparisons, 1);
+        return compare(a, b);
+    }
+
+    void init_header()
+    {
+        header.left = &header;
+        header.right = &header;
+        root = nil();
+        leftmost = &header;
+        rightmost = &header;
+        header.set_parent(root);
+        _size = 0;
+    }
+
+    // Points the root back at this tree's header after the roots of two
+    // trees were exchanged.
+    void relink_header()
+    {
+        header.set_parent(root);
+        if (root == nil())
+        {
+            leftmost = &header;
+            rightmost = &header;
+        }
+        else
+            root->set_parent(&header);
+    }
+
+    // Consumes the sorted prefix of [first, last), dropping duplicates, and
+    // stops at the first element that is out of order.
+    template <class InputIt>
+    void build_sorted(InputIt& first, InputIt last)
     {
-        Node<T> tmp;
-        tmp.c = 'B';
-        tmp.is_nil = true;
+        NodePtr head = nil();
+        NodePtr tail = nil();
+        size_t n = 0;
         try
         {
-            NIL = alloc.allocate(1);
+            for (; first != last; ++first)
+            {
+                NodePtr z = create_node(*first);
+                if (tail != nil() && !key_less(access(value(tail)), access(value(z))))
+                {
+                    bool duplicate = !key_less(access(value(z)), access(value(tail)));
+                    destroy_node(z);
+                    if (duplicate)
+                        continue;
+                    break;
+                }
+                z->right = nil();
+                if (tail == nil())
+                    head = z;
+                else
+                    tail->right = z;
+                tail = z;
+                n++;
+            }
         }
-        catch (const std::bad_alloc& e)
+        catch (...)
         {
-            std::cerr << "Allocation failed: " << e.what() << '\n';
-            delete_all();
-            delete_NIL();
-            _size = 0;
+            while (head != nil())
+            {
+                NodePtr next = head->right;
+                destroy_node(head);
+                head = next;
+            }
+            throw;
         }
-        alloc.construct(NIL, tmp);
+        if (n == 0)
+            return;
+        size_t red_depth = 0;
+        for (size_t i = n; i > 1; i >>= 1)
+            red_depth++;
+        leftmost = head;
+        rightmost = tail;
+        root = build_helper(head, n, 0, red_depth);
+        root->set_parent(&header);
+        header.set_parent(root);
+        _size = n;
+    }
+
+    // Takes the next n nodes of the chain linked through their right
+    // pointers and returns them as a balanced subtree. Only the nodes on
+    // the deepest level are red, so all paths have the same black height.
+    NodePtr build_helper(NodePtr& chain, size_t n, size_t depth, size_t red_depth)
+    {
+        if (n == 0)
+            return nil();
+        NodePtr left = build_helper(chain, n / 2, depth + 1, red_depth);
+        NodePtr node = chain;
+        chain = chain->right;
+        node->left = left;
+        if (left != nil())
+            left->set_parent(node);
+        node->right = build_helper(chain, n - n / 2 - 1, depth + 1, red_depth);
+        if (node->right != nil())
+            node->right->set_parent(node);
+        Augment::template update<T>(node);
+        if (depth != 0 && depth == red_depth)
+            node->set_red();
+        else
+            node->set_black();
+        return node;
+    }
+
+#if __cplusplus >= 201103L
+    template <class... Args>
+    NodePtr create_node(Args&&... args)
+    {
+        node_type* z = alloc.allocate(1);
+        FT_STAT(_stats, allocations, 1);
+        try
+        {
+            std::allocator_traits<node_allocator>::construct(alloc, z,
+                rb_emplace_tag(), std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            alloc.deallocate(z, 1);
+            FT_STAT(_stats, deallocations, 1);
+            throw;
+        }
+        return z;
+    }
+#else
+    NodePtr create_node(const T& elem)
+    {
+        node_type* z = alloc.allocate(1);
+        FT_STAT(_stats, allocations, 1);
+        try
+        {
+            alloc.construct(z, node_type(elem));
+        }
+        catch (...)
+        {
+            alloc.deallocate(z, 1);
+            FT_STAT(_stats, deallocations, 1);
+            throw;
+        }
+        return z;
+    }
+#endif
+
+    void destroy_node(NodePtr z)
+    {
+        node_type* n = static_cast<node_type*>(z);
+        alloc.destroy(n);
+        alloc.deallocate(n, 1);
+        FT_STAT(_stats, deallocations, 1);
+    }
+
+    template <class V>
+    void fold_helper(NodePtr x, const key_type& lo, const key_type& hi,
+        bool lo_bound, bool hi_bound, V& acc) const
+    {
+        while (x != nil())
+        {
+            if (!lo_bound && !hi_bound)
+            {
+                acc = Augment::combine(acc, Augment::template value<T>(x));
+                return;
+            }
+            if (lo_bound && key_less(access(value(x)), lo))
+                x = x->right;
+            else if (hi_bound && !key_less(access(value(x)), hi))
+                x = x->left;
+            else
+            {
+                fold_helper(x->left, lo, hi, lo_bound, false, acc);
+                acc = Augment::combine(acc, Augment::lift(value(x)));
+                lo_bound = false;
+                x = x->right;
+            }
+        }
+    }
+
+    // Refreshes the augmented data of n and all of its ancestors.
+    void update_path(NodePtr n)
+    {
+        if (!Augment::enabled)
+            return;
+        for (; n != &header; n = n->parent())
+            Augment::template update<T>(n);
     }
 
     void transplant(NodePtr u, NodePtr v)
     {
 
-        if (u->p == NIL)
+        if (u->parent() == &header)
             root = v;
-        else if (u == u->p->left)
-            u->p->left = v;
+        else if (u == u->parent()->left)
+            u->parent()->left = v;
         else
-            u->p->right = v;
-        v->p = u->p;
+            u->parent()->right = v;
+        if (v != nil())
+            v->set_parent(u->parent());
     }
 
     void print_helper(NodePtr root, int space)
     {
-        if (root == NIL)
+        if (root == nil())
             return;
         space += 10;
         print_helper(root->right, space);
         std::cout << std::endl;
         for (int i = 10; i < space; i++)
             std::cout << " ";
-        std::cout << access(root->key) << root->c << "\n";
+        std::cout << access(value(root)) << (root->is_red() ? 'R' : 'B') << "\n";
         print_helper(root->left, space);
     }
 
    
 
-    NodePtr  search_helper(key_type k, NodePtr root_ptr) const
-    {
-        if (root_ptr == NIL || k == access(root_ptr->key))
-            return root_ptr;
-        if (compare(k, access(root_ptr->key)))
-            return search_helper(k, root_ptr->left);
-        else
-            return search_helper(k, root_ptr->right);
-    }
-    
-
     void rotateLeft(NodePtr x)
     {
+        FT_STAT(_stats, rotations, 1);
         NodePtr y = x->right;
         x->right = y->left; 
-        if (y->left != NIL)
-            y->left->p = x;
-        y->p = x->p;
-        if (x->p == NIL)
+        if (y->left != nil())
+            y->left->set_parent(x);
+        y->set_parent(x->parent());
+        if (x->parent() == &header)
             root = y;
-        else if (x == x->p->left) //x is left child
-            x->p->left = y;
+        else if (x == x->parent()->left) //x is left child
+            x->parent()->left = y;
         else                       //x is right child
-            x->p->right = y;
+            x->parent()->right = y;
         y->left = x;
-        x->p = y;
+        x->set_parent(y);
+        Augment::template update<T>(x);
+        Augment::template update<T>(y);
     }
 
     void rotateRight(NodePtr x)
     {
+        FT_STAT(_stats, rotations, 1);
         NodePtr y = x->left;
         x->left = y->right;  
-        if (y->right != NIL)
-            y->right->p = x;
-        y->p = x->p;
-        if (x->p == NIL)    
+        if (y->right != nil())
+            y->right->set_parent(x);
+        y->set_parent(x->parent());
+        if (x->parent() == &header)
             root = y;
-        else if (x == x->p->right) 
-            x->p->right = y;
+        else if (x == x->parent()->right) 
+            x->parent()->right = y;
         else
-            x->p->left = y;
+            x->parent()->left = y;
         y->right = x;
-        x->p = y;
+        x->set_parent(y);
+        Augment::template update<T>(x);
+        Augment::template update<T>(y);
     }
 
+    // Frees the subtree at node without recursion nor rebalancing: left
+    // children are rotated up until the node has none, then it goes and
+    // its right child takes its place.
     void delete_helper(NodePtr node)
     {
-        if (node == NIL)
+        while (node != nil())
+        {
+            NodePtr left = node->left;
+            if (left != nil())
+            {
+                node->left = left->right;
+                left->right = node;
+                node = left;
+            }
+            else
+            {
+                NodePtr right = node->right;
+                destroy_node(node);
+                node = right;
+            }
+        }
+    }
+
+    // Nodes with nothing to destroy, from a pool this tree does not share,
+    // are freed all at once with the pool's slabs.
+    bool purge_nodes(ft::true_type)
+    {
+        if (!ft::is_trivially_destructible<node_type>::value || !alloc.purge())
+            return false;
+        FT_STAT(_stats, deallocations, _size);
+        return true;
+    }
+
+    bool purge_nodes(ft::false_type)
+    {
+        return false;
+    }
+
+    // Takes a copy of the nodes of other, shape and colors included, in
+    // O(n) and without comparing keys. The tree must be empty.
+    void copy_tree(const RBT& other)
+    {
+        if (other.root == nil())
             return;
-        delete_helper(node->left);
-        delete_helper(node->right);
-        alloc.destroy(node);
-        alloc.deallocate(node, 1);
+        root = clone_tree(other.root);
+        relink_header();
+        leftmost = min_helper(root);
+        rightmost = max_helper(root);
+        _size = other._size;
     }
 
-    NodePtr max_helper(NodePtr x) const
+    NodePtr clone_node(NodePtr src, NodePtr parent)
     {
-        NodePtr tmp = x;
-        while (tmp->right != NIL)
-        {
-            tmp = tmp->right;
-        }
-        return tmp;
+        NodePtr n = create_node(value(src));
+        n->left = nil();
+        n->right = nil();
+        n->set_parent(parent);
+        n->copy_color(src);
+        return n;
     }
 
-    NodePtr min_helper(NodePtr x) const
+    // Walks the source in preorder through the parent links, building the
+    // copy alongside; augmented data is computed as each subtree of the
+    // copy is completed.
+    NodePtr clone_tree(NodePtr src)
     {
-        NodePtr tmp = x;
-        if (tmp == NIL)
-            return tmp;
-        while (tmp->left != NIL)
+        NodePtr top = clone_node(src, &header);
+        NodePtr s = src;
+        NodePtr d = top;
+        try
         {
-            tmp = tmp->left;
+            for (;;)
+            {
+                if (s->left != nil())
+                {
+                    d->left = clone_node(s->left, d);
+                    s = s->left;
+                    d = d->left;
+                    continue;
+                }
+                if (s->right != nil())
+                {
+                    d->right = clone_node(s->right, d);
+                    s = s->right;
+                    d = d->right;
+                    continue;
+                }
+                for (;;)
+                {
+                    Augment::template update<T>(d);
+                    if (s == src)
+                        return top;
+                    NodePtr p = s->parent();
+                    if (s == p->left && p->right != nil())
+                    {
+                        d->parent()->right = clone_node(p->right, d->parent());
+                        s = p->right;
+                        d = d->parent()->right;
+                        break;
+                    }
+                    s = p;
+                    d = d->parent();
+                }
+            }
+        }
+        catch (...)
+        {
+            delete_helper(top);
+            throw;
         }
-        return tmp;
     }
 
     void insert_fixup(NodePtr z)
     {
-        while (z->p->c == 'R')
+        while (z->parent()->is_red())
         {
-            if (z->p == z->p->p->left)     //x is left child
+            FT_STAT(_stats, fixup_steps, 1);
+            if (z->parent() == z->parent()->parent()->left)     //x is left child
             {
-                NodePtr y = z->p->p->right;
-                if (y->c == 'R') //case 1
+                NodePtr y = z->parent()->parent()->right;
+                if (y->is_red()) //case 1
                 {
-                    z->p->c = 'B';
-                    y->c = 'B';
-                    z->p->p->c = 'R';
-                    z = z->p->p;
+                    z->parent()->set_black();
+                    y->set_black();
+                    z->parent()->parent()->set_red();
+                    z = z->parent()->parent();
                 }
                 else            //case 2, 3
                 {
-                    if (z == z->p->right)
+                    if (z == z->parent()->right)
                     {
-                        z = z->p;
+                        z = z->parent();
                         rotateLeft(z);
                     }
-                    z->p->c = 'B';
-                    z->p->p->c = 'R';
-                    rotateRight(z->p->p);
+                    z->parent()->set_black();
+                    z->parent()->parent()->set_red();
+                    rotateRight(z->parent()->parent());
                 }
 
             }
             else        //x is right child
             {
-                NodePtr y = z->p->p->left;
-                if (y->c == 'R') //case 1
+                NodePtr y = z->parent()->parent()->left;
+                if (y->is_red()) //case 1
                 {
-                    z->p->c = 'B';
-                    y->c = 'B';
-                    z->p->p->c = 'R';
-                    z = z->p->p;
+                    z->parent()->set_black();
+                    y->set_black();
+                    z->parent()->parent()->set_red();
+                    z = z->parent()->parent();
                 }
                 else            //case 2, 3
                 {
-                    if (z == z->p->left)
+                    if (z == z->parent()->left)
                     {
-                        z = z->p;
+                        z = z->parent();
                         rotateRight(z);
                     }
-                    z->p->c = 'B';
-                    z->p->p->c = 'R';
-                    rotateLeft(z->p->p);
+                    z->parent()->set_black();
+                    z->parent()->parent()->set_red();
+                    rotateLeft(z->parent()->parent());
                 }
             }
         }
-        root->c = 'B';
+        root->set_black();
     }
 
     NodePtr insert_helper(NodePtr z, NodePtr& root)
     {
-        NodePtr y = NIL;
+        NodePtr y = &header;
         NodePtr temp = root;
-        while (temp != NIL)
+        bool left = true;
+        while (temp != nil())
         {
             y = temp;
-            if (compare(access(z->key), access(temp->key)))
-                temp = temp->left;
-            else
-                temp = temp->right;
+            left = key_less(access(value(z)), access(value(temp)));
+            temp = left ? temp->left : temp->right;
         }
-        z->p = y;
-        if (y == NIL)
+        return attach(z, y, left);
+    }
+
+    // Links the detached node z as the left or right child of y, which must
+    // be free on that side, and rebalances.
+    NodePtr attach(NodePtr z, NodePtr y, bool left)
+    {
+        z->set_parent(y);
+        if (y == &header)
+        {
             root = z;
-        else if (compare(access(z->key), access(y->key)))
+            leftmost = z;
+            rightmost = z;
+        }
+        else if (left)
+        {
             y->left = z;
+            if (y == leftmost)
+                leftmost = z;
+        }
         else
+        {
             y->right = z;
-        z->left = NIL;
-        z->right = NIL;
+            if (y == rightmost)
+                rightmost = z;
+        }
+        z->left = nil();
+        z->right = nil();
         _size++;
-       insert_fixup(z);
-       NIL->p = root;
-       return z;
+        update_path(z);
+        insert_fixup(z);
+        header.set_parent(root);
+        return z;
+    }
+
+    // Unique insertion next to hint. Returns the node already holding an
+    // equal key, if any.
+    NodePtr insert_hint(NodePtr hint, const T& elem)
+    {
+        NodePtr parent;
+        bool left;
+        NodePtr found = hint_position(hint, access(elem), parent, left);
+        if (found != &header)
+            return found;
+        return insert_at(parent, left, elem);
     }
 
-    void remove_fixup(NodePtr x)
+    // Like find_insert_position, but when key belongs right before or
+    // right after hint the position is found without descending from the
+    // root.
+    NodePtr hint_position(NodePtr hint, const key_type& key, NodePtr& parent, bool& left)
     {
-        while(x != root && x->c == 'B')
+        if (hint == &header)
+        {
+            if (_size > 0 && key_less(access(value(rightmost)), key))
+                return position(rightmost, false, parent, left);
+        }
+        else if (key_less(key, access(value(hint))))
         {
-            if(x == x->p->left)
+            if (hint == leftmost)
+                return position(hint, true, parent, left);
+            NodePtr before = predecessor(hint);
+            if (key_less(access(value(before)), key))
             {
-                NodePtr w = x->p->right;
-                if(w->c == 'R')
+                if (before->right == nil())
+                    return position(before, false, parent, left);
+                return position(hint, true, parent, left);
+            }
+        }
+        else if (key_less(access(value(hint)), key))
+        {
+            if (hint == rightmost)
+                return position(hint, false, parent, left);
+            NodePtr after = successor(hint);
+            if (key_less(key, access(value(after))))
+            {
+                if (hint->right == nil())
+                    return position(hint, false, parent, left);
+                return position(after, true, parent, left);
+            }
+        }
+        else
+            return hint;
+        return find_insert_position(key, parent, left);
+    }
+
+    NodePtr position(NodePtr p, bool l, NodePtr& parent, bool& left) const
+    {
+        parent = p;
+        left = l;
+        return &header;
+    }
+
+    void remove_fixup(NodePtr x, NodePtr x_parent)
+    {
+        while(x != root && x->is_black())
+        {
+            FT_STAT(_stats, fixup_steps, 1);
+            if(x == x_parent->left)
+            {
+                NodePtr w = x_parent->right;
+                if(w->is_red())
                 {
-                    w->c = 'B';
-                    x->p->c = 'R';
-                    rotateLeft(x->p);
-                    w = x->p->right;
+                    w->set_black();
+                    x_parent->set_red();
+                    rotateLeft(x_parent);
+                    w = x_parent->right;
                 }
-                if(w->left->c == 'B' && w->right->c == 'B')
+                if(w->left->is_black() && w->right->is_black())
                 {
-                    w->c = 'R';
-                    x = x->p;
+                    w->set_red();
+                    x = x_parent;
+                    x_parent = x_parent->parent();
                 }
                 else
                 {
-                  if(w->right->c == 'B')
+                  if(w->right->is_black())
                   {
-                    w->left->c = 'B';
-                    w->c = 'R';
+                    w->left->set_black();
+                    w->set_red();
                     rotateRight(w);
-                    w = x->p->right;
+                    w = x_parent->right;
                   }
-                  w->c = x->p->c;
-                  x->p->c = 'B';
-                  w->right->c = 'B';
-                  rotateLeft(x->p);
+                  w->copy_color(x_parent);
+                  x_parent->set_black();
+                  w->right->set_black();
+                  rotateLeft(x_parent);
                   x = root;
                 }
           }
           else
           {
-            NodePtr w = x->p->left;
-            if(w->c == 'R')
+            NodePtr w = x_parent->left;
+            if(w->is_red())
             {
-              w->c = 'B';
-              x->p->c = 'R';
-              rotateRight(x->p);
-              w = x->p->left;
+              w->set_black();
+              x_parent->set_red();
+              rotateRight(x_parent);
+              w = x_parent->left;
             }
-            if(w->right->c == 'B' && w->left->c == 'B')
+            if(w->right->is_black() && w->left->is_black())
             {
-              w->c = 'R';
-              x = x->p;
+              w->set_red();
+              x = x_parent;
+              x_parent = x_parent->parent();
             }
             else
             {
-              if(w->left->c == 'B')
+              if(w->left->is_black())
               {
-                w->right->c = 'B';
-                w->c = 'R';
+                w->right->set_black();
+                w->set_red();
                 rotateLeft(w);
-                w = x->p->left;
+                w = x_parent->left;
               }
-              w->c = x->p->c;
-              x->p->c = 'B';
-              w->left->c = 'B';
-              rotateRight(x->p);
+              w->copy_color(x_parent);
+              x_parent->set_black();
+              w->left->set_black();
+              rotateRight(x_parent);
               x = root;
             }
           }
         }
-        x->c = 'B';
+        if (x != nil())
+            x->set_black();
     }
 };
-
@@ -0,0 +1,324 @@
+#pragma once
+#include <iostream>
+#include "reverse_iterator.hpp"
+#include "type_traits.hpp"
+#include "bidirectional_iterator.hpp"
+#include "algorithm.hpp"
+#include <new>
+#include "RBT.hpp"
+#include "pool_allocator.hpp"
+#include "tree_policy.hpp"
+
+namespace ft
+{
+    template <class T>
+    struct plus_aggregate
+    {
+        typedef T value_type;
+
+        static T combine(const T& a, const T& b)
+        {
+            return a + b;
+        }
+    };
+
+    template <class T>
+    struct min_aggregate
+    {
+        typedef T value_type;
+
+        static T combine(const T& a, const T& b)
+        {
+            return b < a ? b : a;
+        }
+    };
+
+    template <class T>
+    struct max_aggregate
+    {
+        typedef T value_type;
+
+        static T combine(const T& a, const T& b)
+        {
+            return a < b ? b : a;
+        }
+    };
+
+    /*
+    ** Ordered map that keeps the Op-combination (sum, min, max, ...) of the
+    ** mapped values of every subtree, so accumulate() over a key range is
+    ** O(log n). Mapped values are read-only through iterators; use
+    ** insert_or_assign() to change them.
+    */
+    template<
+        class Key,
+        class T,
+        class Op = ft::plus_aggregate<T>,
+        class Compare = std::less<Key>,
+        class Allocator = ft::pool_allocator<ft::pair<const Key, T> >
+    > class aggregate_map
+    {
+    public:
+
+        typedef Key                                             key_type;
+        typedef T                                               mapped_type;
+        typedef ft::pair<const Key, T>                          value_type;
+        typedef std::size_t                                     size_type;
+        typedef std::ptrdiff_t                                  difference_type;
+        typedef Compare                                         key_compare;
+        typedef Allocator                                       allocator_type;
+        typedef value_type&                                     reference;
+        typedef const value_type&                               const_reference;
+        typedef typename Allocator::pointer                     pointer;
+        typedef typename Allocator::const_pointer               const_pointer;
+        typedef ft::bidirectional_const_iterator<value_type>    iterator;
+        typedef ft::bidirectional_const_iterator<value_type>    const_iterator;
+        typedef ft::reverse_iterator<const_iterator>            reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+    private:
+
+        template <typename Type>
+        struct SelectFirst
+        {
+            typedef typename Type::first_type key_type;
+            key_type &operator()(Type &val)
+            {
+                return val.first;
+            }
+            const key_type &operator()(const Type &val) const
+            {
+                return val.first;
+            }
+        };
+
+        struct LiftMapped
+        {
+            typedef T value_type;
+
+            static T lift(const ft::pair<const Key, T>& val)
+            {
+                return val.second;
+            }
+
+            static T combine(const T& a, const T& b)
+            {
+                return Op::combine(a, b);
+            }
+        };
+
+        typedef  rb_node_base*                                              NodePtr;
+        typedef  ft::aggregate_augment<LiftMapped>                          augment;
+
+        RBT<value_type, SelectFirst<value_type>, Compare, Allocator, augment>   _tree;
+        allocator_type                                                          _alloc;
+
+    public:
+        /*              Constructors            */
+
+        aggregate_map() : _tree(Compare()) {}
+
+        explicit aggregate_map( const Compare& comp,
+            const Allocator& alloc = Allocator()) : _tree(comp), _alloc(alloc) {}
+
+        template< class InputIt >
+        aggregate_map( InputIt first, InputIt last, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator(), typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+            : _tree(comp), _alloc(alloc)
+        {
+            _tree.insert_range(first, last);
+        }
+
+        aggregate_map( const aggregate_map& other )
+        : _tree(other._tree) {}
+
+        /*             Destructor          */
+
+        ~aggregate_map()
+        {
+            _tree.delete_all();
+        }
+
+        aggregate_map& operator=( const aggregate_map& other )
+        {
+            _tree = other._tree;
+            return *this;
+        }
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        /*             Element access           */
+
+        const T& at( const Key& key ) const
+        {
+            NodePtr ret = _tree.search(key);
+            if (ret == _tree.getEnd())
+                throw  std::out_of_range("aggregate_map::at");
+            return _tree.value(ret).second;
+        }
+
+        /*              Iterators               */
+
+        const_iterator begin() const
+        {
+            return const_iterator(_tree.size() == 0 ? _tree.getEnd() : _tree.minimum());
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(_tree.getEnd());
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        /*             Capacity                */
+
+        bool empty() const
+        {
+            return _tree.size() == 0;
+        }
+
+        size_type size() const
+        {
+            return _tree.size();
+        }
+
+        size_type max_size() const
+        {
+            return _alloc.max_size();
+        }
+
+        /*              Modifiers           */
+
+        void clear()
+        {
+            _tree.delete_all();
+        }
+
+        ft::pair<iterator, bool> insert( const value_type& value )
+        {
+            ft::pair<NodePtr, bool> ret = _tree.insert_unique(value);
+            return ft::make_pair(iterator(ret.first), ret.second);
+        }
+
+        iterator insert( iterator pos, const value_type& value )
+        {
+            return iterator(_tree.insert(pos, value));
+        }
+
+        template< class InputIt >
+        void insert( InputIt first, InputIt last, typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+        {
+            _tree.insert_range(first, last);
+        }
+
+        ft::pair<iterator, bool> insert_or_assign( const Key& key, const T& obj )
+        {
+            NodePtr parent;
+            bool left;
+            NodePtr tmp = _tree.find_insert_position(key, parent, left);
+            if (tmp == _tree.getEnd())
+                return ft::make_pair(iterator(_tree.insert_at(parent, left, value_type(key, obj))), true);
+            _tree.value(tmp).second = obj;
+            _tree.refresh(tmp);
+            return ft::make_pair(iterator(tmp), false);
+        }
+
+        void erase( iterator pos )
+        {
+            _tree.erase_node(pos.base());
+        }
+
+        void erase( iterator first, iterator last )
+        {
+            _tree.erase_range(first.base(), last.base());
+        }
+
+        size_type erase( const Key& key )
+        {
+            NodePtr tmp = _tree.search(key);
+            if (tmp == _tree.getEnd())
+                return 0;
+            _tree.erase_node(tmp);
+            return 1;
+        }
+
+        void swap( aggregate_map& other )
+        {
+            this->_tree.swap(other._tree);
+        }
+
+        /*              Lookup              */
+
+        size_type count( const Key& key ) const
+        {
+            return (_tree.search(key) == _tree.getEnd() ? 0 : 1);
+        }
+
+        const_iterator find( const Key& key ) const
+        {
+            return const_iterator(_tree.search(key));
+        }
+
+        ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        const_iterator lower_bound( const Key& key ) const
+        {
+            return const_iterator(_tree.lower_bound(key));
+        }
+
+        const_iterator upper_bound( const Key& key ) const
+        {
+            return const_iterator(_tree.upper_bound(key));
+        }
+
+        // Combines init with the mapped values of all keys in [lo, hi).
+        T accumulate( const Key& lo, const Key& hi, T init ) const
+        {
+            _tree.fold(lo, hi, init);
+            return init;
+        }
+
+        /*              Observers               */
+
+        key_compare key_comp() const
+        {
+            return _tree.key_comp();
+        }
+    };
+
+    template< class Key, class T, class Op, class Compare, class Alloc >
+    bool operator==( const ft::aggregate_map<Key,T,Op,Compare,Alloc>& lhs,
+                 const ft::aggregate_map<Key,T,Op,Compare,Alloc>& rhs )
+    {
+        return ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template< class Key, class T, class Op, class Compare, class Alloc >
+    bool operator!=( const ft::aggregate_map<Key,T,Op,Compare,Alloc>& lhs,
+                 const ft::aggregate_map<Key,T,Op,Compare,Alloc>& rhs )
+    {
+        return !(lhs == rhs);
+    }
+
+    template< class Key, class T, class Op, class Compare, class Alloc >
+    void swap( ft::aggregate_map<Key,T,Op,Compare,Alloc>& lhs,
+           ft::aggregate_map<Key,T,Op,Compare,Alloc>& rhs )
+    {
+        return lhs.swap(rhs);
+    }
+}
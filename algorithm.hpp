@@ -1,10 +1,59 @@
-#pragma once 
+#pragma once
+
+#include <climits>
+#include <cstring>
+#include "iterator.hpp"
+#include "random_access_iterator.hpp"
+#include "type_traits.hpp"
+#include "simd.hpp"
 
 namespace ft
 {
+    /*
+    ** contiguous_iterator tells whether It walks plain memory (raw pointers
+    ** and the vector iterators), and if so gives back the address.
+    */
+    template <class It>
+    struct contiguous_iterator : false_type
+    {
+        typedef void value_type;
+    };
+
+    template <class T>
+    struct contiguous_iterator<T*> : true_type
+    {
+        typedef typename ft::remove_cv<T>::type value_type;
+        static T* address(T* p) { return p; }
+    };
+
+    template <class T>
+    struct contiguous_iterator<ft::random_access_iterator<T> > : true_type
+    {
+        typedef typename ft::remove_cv<T>::type value_type;
+        static T* address(const ft::random_access_iterator<T>& it) { return it.base(); }
+    };
+
+    // Both ranges are contiguous arrays of the same bitwise comparable type.
+    template <class It1, class It2>
+    struct is_memcmp_range : integral_constant<bool,
+        contiguous_iterator<It1>::value && contiguous_iterator<It2>::value
+        && ft::is_same<typename contiguous_iterator<It1>::value_type,
+                       typename contiguous_iterator<It2>::value_type>::value
+        && ft::is_bitwise_comparable<typename contiguous_iterator<It1>::value_type>::value> {};
+
+
+    // memcmp's own ordering is the one of unsigned bytes.
+    template <class T> struct memcmp_orders : false_type {};
+    template <> struct memcmp_orders<bool> : true_type {};
+    template <> struct memcmp_orders<unsigned char> : true_type {};
+#if CHAR_MIN == 0
+    template <> struct memcmp_orders<char> : true_type {};
+#endif
+
+
     template<class InputIt1, class InputIt2>
-    bool lexicographical_compare(InputIt1 first1, InputIt1 last1,
-                                 InputIt2 first2, InputIt2 last2)
+    bool do_lexicographical_compare(InputIt1 first1, InputIt1 last1,
+                                    InputIt2 first2, InputIt2 last2, ft::false_type)
     {
         for (; (first1 != last1) && (first2 != last2); ++first1, (void) ++first2)
         {
@@ -13,15 +62,46 @@ namespace ft
             if (*first2 < *first1)
                 return false;
         }
-    
+
         return (first1 == last1) && (first2 != last2);
     }
 
+    // Find the first element that differs bytewise, then order on it alone.
+    template<class It1, class It2>
+    bool do_lexicographical_compare(It1 first1, It1 last1,
+                                    It2 first2, It2 last2, ft::true_type)
+    {
+        typedef typename contiguous_iterator<It1>::value_type value_type;
+        std::size_t n1 = last1 - first1;
+        std::size_t n2 = last2 - first2;
+        std::size_t n = n1 < n2 ? n1 : n2;
+        if (n == 0)
+            return n1 < n2;
+        const value_type* a = contiguous_iterator<It1>::address(first1);
+        const value_type* b = contiguous_iterator<It2>::address(first2);
+        if (ft::memcmp_orders<value_type>::value)
+        {
+            int r = std::memcmp(a, b, n);
+            return r != 0 ? r < 0 : n1 < n2;
+        }
+        std::size_t i = ft::mismatch_bytes(reinterpret_cast<const unsigned char*>(a),
+            reinterpret_cast<const unsigned char*>(b), n * sizeof(value_type)) / sizeof(value_type);
+        if (i < n)
+            return a[i] < b[i];
+        return n1 < n2;
+    }
+
+    template<class InputIt1, class InputIt2>
+    bool lexicographical_compare(InputIt1 first1, InputIt1 last1,
+                                 InputIt2 first2, InputIt2 last2)
+    {
+        return ft::do_lexicographical_compare(first1, last1, first2, last2,
+            ft::is_memcmp_range<InputIt1, InputIt2>());
+    }
+
     template <class Input1, class Input2>
-    bool equal(Input1 first1, Input1 last1, Input2 first2, Input2 last2)
+    bool do_equal(Input1 first1, Input1 last1, Input2 first2, ft::false_type)
     {
-        if (ft::distance(first1, last1) != ft::distance(first2, last2))
-            return false;
         while (first1 != last1)
         {
             if (*first1 != *first2)
@@ -31,4 +111,272 @@ namespace ft
         }
         return true;
     }
+
+    template <class It1, class It2>
+    bool do_equal(It1 first1, It1 last1, It2 first2, ft::true_type)
+    {
+        std::size_t n = last1 - first1;
+        if (n == 0)
+            return true;
+        return std::memcmp(contiguous_iterator<It1>::address(first1),
+            contiguous_iterator<It2>::address(first2),
+            n * sizeof(typename contiguous_iterator<It1>::value_type)) == 0;
+    }
+
+    template <class Input1, class Input2>
+    bool equal(Input1 first1, Input1 last1, Input2 first2, Input2 last2)
+    {
+        if (ft::distance(first1, last1) != ft::distance(first2, last2))
+            return false;
+        return ft::do_equal(first1, last1, first2, ft::is_memcmp_range<Input1, Input2>());
+    }
+
+    /*
+    ** Base of the sequence containers C that compare element-wise: equal
+    ** when their elements are, ordered lexicographically. The operators
+    ** are found through C by argument-dependent lookup.
+    */
+    template <class C>
+    struct sequence_comparisons
+    {
+        friend bool operator==(const C& lhs, const C& rhs)
+        {
+            return ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend bool operator!=(const C& lhs, const C& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator<(const C& lhs, const C& rhs)
+        {
+            return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend bool operator>(const C& lhs, const C& rhs)
+        {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const C& lhs, const C& rhs)
+        {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const C& lhs, const C& rhs)
+        {
+            return !(lhs < rhs);
+        }
+    };
+
+    /*
+    ** Scans. Over contiguous ranges of plain numbers (and a value of the
+    ** very same type) they run the vector kernels of simd.hpp; anything
+    ** else takes the element loop.
+    */
+
+    template <class T> struct is_simd_scalar
+        : integral_constant<bool, (ft::is_integral<T>::value && !ft::is_same<T, bool>::value)
+            || ft::is_same<T, float>::value || ft::is_same<T, double>::value> {};
+
+    template <class It, class U>
+    struct is_simd_search : integral_constant<bool,
+        contiguous_iterator<It>::value
+        && ft::is_simd_scalar<typename contiguous_iterator<It>::value_type>::value
+        && ft::is_same<typename contiguous_iterator<It>::value_type,
+                       typename ft::remove_cv<U>::type>::value> {};
+
+    // Floating point is left out: NaN has no place in a lanewise min.
+    template <class It>
+    struct is_simd_extreme : integral_constant<bool,
+        contiguous_iterator<It>::value
+        && ft::is_simd_scalar<typename contiguous_iterator<It>::value_type>::value
+        && ft::is_integral<typename contiguous_iterator<It>::value_type>::value> {};
+
+    template <class InputIt, class T>
+    InputIt do_find(InputIt first, InputIt last, const T& value, ft::false_type)
+    {
+        for (; first != last; ++first)
+            if (*first == value)
+                break;
+        return first;
+    }
+
+    template <class It, class T>
+    It do_find(It first, It last, const T& value, ft::true_type)
+    {
+        if (first == last)
+            return last;
+        return first + ft::simd_find(contiguous_iterator<It>::address(first),
+            static_cast<std::size_t>(last - first), value);
+    }
+
+    template <class InputIt, class T>
+    InputIt find(InputIt first, InputIt last, const T& value)
+    {
+        return ft::do_find(first, last, value, ft::is_simd_search<InputIt, T>());
+    }
+
+    template <class InputIt, class T>
+    typename ft::iterator_traits<InputIt>::difference_type
+    do_count(InputIt first, InputIt last, const T& value, ft::false_type)
+    {
+        typename ft::iterator_traits<InputIt>::difference_type n = 0;
+        for (; first != last; ++first)
+            if (*first == value)
+                ++n;
+        return n;
+    }
+
+    template <class It, class T>
+    typename ft::iterator_traits<It>::difference_type
+    do_count(It first, It last, const T& value, ft::true_type)
+    {
+        if (first == last)
+            return 0;
+        return ft::simd_count(contiguous_iterator<It>::address(first),
+            static_cast<std::size_t>(last - first), value);
+    }
+
+    template <class InputIt, class T>
+    typename ft::iterator_traits<InputIt>::difference_type
+    count(InputIt first, InputIt last, const T& value)
+    {
+        return ft::do_count(first, last, value, ft::is_simd_search<InputIt, T>());
+    }
+
+    template <class ForwardIt, class Compare>
+    ForwardIt min_element(ForwardIt first, ForwardIt last, Compare comp)
+    {
+        if (first == last)
+            return last;
+        ForwardIt best = first;
+        while (++first != last)
+            if (comp(*first, *best))
+                best = first;
+        return best;
+    }
+
+    template <class ForwardIt, class Compare>
+    ForwardIt max_element(ForwardIt first, ForwardIt last, Compare comp)
+    {
+        if (first == last)
+            return last;
+        ForwardIt best = first;
+        while (++first != last)
+            if (comp(*best, *first))
+                best = first;
+        return best;
+    }
+
+    template <class ForwardIt>
+    ForwardIt do_min_element(ForwardIt first, ForwardIt last, ft::false_type)
+    {
+        if (first == last)
+            return last;
+        ForwardIt best = first;
+        while (++first != last)
+            if (*first < *best)
+                best = first;
+        return best;
+    }
+
+    template <class It>
+    It do_min_element(It first, It last, ft::true_type)
+    {
+        if (first == last)
+            return last;
+        return first + ft::simd_min_index(contiguous_iterator<It>::address(first),
+            static_cast<std::size_t>(last - first));
+    }
+
+    template <class ForwardIt>
+    ForwardIt min_element(ForwardIt first, ForwardIt last)
+    {
+        return ft::do_min_element(first, last, ft::is_simd_extreme<ForwardIt>());
+    }
+
+    template <class ForwardIt>
+    ForwardIt do_max_element(ForwardIt first, ForwardIt last, ft::false_type)
+    {
+        if (first == last)
+            return last;
+        ForwardIt best = first;
+        while (++first != last)
+            if (*best < *first)
+                best = first;
+        return best;
+    }
+
+    template <class It>
+    It do_max_element(It first, It last, ft::true_type)
+    {
+        if (first == last)
+            return last;
+        return first + ft::simd_max_index(contiguous_iterator<It>::address(first),
+            static_cast<std::size_t>(last - first));
+    }
+
+    template <class ForwardIt>
+    ForwardIt max_element(ForwardIt first, ForwardIt last)
+    {
+        return ft::do_max_element(first, last, ft::is_simd_extreme<ForwardIt>());
+    }
+
+    template <class ForwardIt, class T>
+    void do_fill(ForwardIt first, ForwardIt last, const T& value, ft::false_type)
+    {
+        for (; first != last; ++first)
+            *first = value;
+    }
+
+    template <class It, class T>
+    void do_fill(It first, It last, const T& value, ft::true_type)
+    {
+        if (first == last)
+            return;
+        ft::simd_fill(contiguous_iterator<It>::address(first),
+            static_cast<std::size_t>(last - first), value);
+    }
+
+    template <class ForwardIt, class T>
+    void fill(ForwardIt first, ForwardIt last, const T& value)
+    {
+        ft::do_fill(first, last, value, ft::is_simd_search<ForwardIt, T>());
+    }
+
+    // Same element type on both sides and nothing to run but a byte copy.
+    template <class InputIt, class OutputIt>
+    struct is_memmove_range : integral_constant<bool,
+        contiguous_iterator<InputIt>::value && contiguous_iterator<OutputIt>::value
+        && ft::is_same<typename contiguous_iterator<InputIt>::value_type,
+                       typename contiguous_iterator<OutputIt>::value_type>::value
+        && ft::is_trivially_copyable<typename contiguous_iterator<InputIt>::value_type>::value> {};
+
+    template <class InputIt, class OutputIt>
+    OutputIt do_copy(InputIt first, InputIt last, OutputIt d_first, ft::false_type)
+    {
+        for (; first != last; ++first, (void) ++d_first)
+            *d_first = *first;
+        return d_first;
+    }
+
+    template <class It, class OutIt>
+    OutIt do_copy(It first, It last, OutIt d_first, ft::true_type)
+    {
+        std::size_t n = last - first;
+        if (n == 0)
+            return d_first;
+        std::memmove(contiguous_iterator<OutIt>::address(d_first),
+            contiguous_iterator<It>::address(first),
+            n * sizeof(typename contiguous_iterator<It>::value_type));
+        return d_first + n;
+    }
+
+    template <class InputIt, class OutputIt>
+    OutputIt copy(InputIt first, InputIt last, OutputIt d_first)
+    {
+        return ft::do_copy(first, last, d_first, ft::is_memmove_range<InputIt, OutputIt>());
+    }
 }
\ No newline at end of file
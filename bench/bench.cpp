@@ -0,0 +1,642 @@
+/*
+** Microbenchmarks of the ft:: containers against their std:: counterparts.
+**
+**   bench [--max-size N] [--min-ops N] [--trials N] [--filter TEXT] [--csv]
+**
+** Every case runs one operation over n keys (n = 10, 100, ... max-size),
+** repeated until min-ops operations are done, and keeps the best of
+** --trials such passes. Keys come from a fixed seed, so two runs see the
+** same data. Reported per implementation:
+**   ns/op      wall time of the timed part only (setup is not timed)
+**   allocs/op  calls to operator new during the timed part
+**   heap       peak of live operator new bytes over the timed part
+**   rss        peak resident set growth (Linux only; approximate, as the
+**              C library may keep freed memory around)
+*/
+
+#include "../vector.hpp"
+#include "../map.hpp"
+#include "../set.hpp"
+#include "../stack.hpp"
+#include "../unordered_map.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+#include <set>
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+#if defined(__linux__)
+# include <malloc.h>
+#endif
+
+/*              Allocation accounting           */
+
+namespace
+{
+    std::size_t g_alloc_calls = 0;
+    std::size_t g_live_bytes = 0;
+    std::size_t g_peak_bytes = 0;
+
+    // Keeps the block size in front of the block; 16 bytes keep malloc's
+    // alignment.
+    const std::size_t header = 16;
+}
+
+// Out of line, or GCC sees the header arithmetic across new/delete and
+// warns about it.
+__attribute__((noinline)) void* operator new(std::size_t n)
+{
+    void* p = std::malloc(n + header);
+    if (!p)
+        throw std::bad_alloc();
+    *static_cast<std::size_t*>(p) = n;
+    ++g_alloc_calls;
+    g_live_bytes += n;
+    if (g_live_bytes > g_peak_bytes)
+        g_peak_bytes = g_live_bytes;
+    return static_cast<char*>(p) + header;
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept
+{
+    if (!p)
+        return;
+    char* block = static_cast<char*>(p) - header;
+    g_live_bytes -= *reinterpret_cast<std::size_t*>(block);
+    std::free(block);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    ::operator delete(p);
+}
+
+namespace
+{
+    /*              Resident set            */
+
+    // Resets the kernel's peak RSS mark so the next read covers one case.
+    void reset_peak_rss()
+    {
+#if defined(__linux__)
+        malloc_trim(0);
+        if (FILE* f = std::fopen("/proc/self/clear_refs", "w"))
+        {
+            std::fputs("5", f);
+            std::fclose(f);
+        }
+#endif
+    }
+
+    // Field of /proc/self/status in kB, or 0 when unavailable.
+    long read_status_kb(const char* field)
+    {
+        long kb = 0;
+#if defined(__linux__)
+        if (FILE* f = std::fopen("/proc/self/status", "r"))
+        {
+            char line[256];
+            std::size_t len = std::strlen(field);
+            while (std::fgets(line, sizeof(line), f))
+                if (std::strncmp(line, field, len) == 0)
+                {
+                    kb = std::atol(line + len);
+                    break;
+                }
+            std::fclose(f);
+        }
+#else
+        (void)field;
+#endif
+        return kb;
+    }
+
+    /*              Keys            */
+
+    struct big_pod
+    {
+        uint32_t    key;
+        char        payload[124];
+
+        bool operator<(const big_pod& other) const { return key < other.key; }
+        bool operator==(const big_pod& other) const { return key == other.key; }
+    };
+
+    uint64_t g_rng = 0x9E3779B97F4A7C15ull;
+
+    uint64_t next_random()
+    {
+        g_rng ^= g_rng << 13;
+        g_rng ^= g_rng >> 7;
+        g_rng ^= g_rng << 17;
+        return g_rng;
+    }
+
+    void make_key(uint32_t id, int& out) { out = static_cast<int>(id); }
+
+    // Long enough to stay out of the small string buffer.
+    void make_key(uint32_t id, std::string& out)
+    {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "key-%010u-padding", id);
+        out = buf;
+    }
+
+    void make_key(uint32_t id, big_pod& out)
+    {
+        out.key = id;
+        std::memset(out.payload, static_cast<int>(id & 0x7F), sizeof(out.payload));
+    }
+
+    std::size_t checksum(int k) { return static_cast<std::size_t>(k); }
+    std::size_t checksum(const std::string& k) { return k.size(); }
+    std::size_t checksum(const big_pod& k) { return k.key; }
+
+    // n distinct keys in a shuffled order that only depends on n.
+    template <class K>
+    void make_keys(std::size_t n, std::vector<K>& keys)
+    {
+        std::vector<uint32_t> ids(n);
+        for (std::size_t i = 0; i < n; ++i)
+            ids[i] = static_cast<uint32_t>(i);
+        g_rng = 0x9E3779B97F4A7C15ull ^ n;
+        for (std::size_t i = n; i > 1; --i)
+            std::swap(ids[i - 1], ids[next_random() % i]);
+        keys.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            make_key(ids[i], keys[i]);
+    }
+
+    volatile std::size_t g_sink;
+
+    /*              Cases           */
+
+    // A case builds its state in setup(), does n operations in run() (the
+    // only timed part) and drops everything in teardown().
+
+    template <class V, class K>
+    struct vector_push_back
+    {
+        static const char* name() { return "push_back"; }
+        const std::vector<K>& keys;
+        V* v;
+        explicit vector_push_back(const std::vector<K>& k) : keys(k), v(NULL) {}
+        void setup() { v = new V; }
+        void run() { for (std::size_t i = 0; i < keys.size(); ++i) v->push_back(keys[i]); }
+        void teardown() { delete v; }
+    };
+
+    template <class V, class K>
+    struct vector_reserve_push_back
+    {
+        static const char* name() { return "reserve+push_back"; }
+        const std::vector<K>& keys;
+        V* v;
+        explicit vector_reserve_push_back(const std::vector<K>& k) : keys(k), v(NULL) {}
+        void setup() { v = new V; }
+        void run()
+        {
+            v->reserve(keys.size());
+            for (std::size_t i = 0; i < keys.size(); ++i)
+                v->push_back(keys[i]);
+        }
+        void teardown() { delete v; }
+    };
+
+    template <class V, class K>
+    struct vector_insert_front
+    {
+        static const char* name() { return "insert_front"; }
+        const std::vector<K>& keys;
+        V* v;
+        explicit vector_insert_front(const std::vector<K>& k) : keys(k), v(NULL) {}
+        void setup() { v = new V; }
+        void run() { for (std::size_t i = 0; i < keys.size(); ++i) v->insert(v->begin(), keys[i]); }
+        void teardown() { delete v; }
+    };
+
+    template <class V, class K>
+    struct vector_erase_front
+    {
+        static const char* name() { return "erase_front"; }
+        const std::vector<K>& keys;
+        V* v;
+        explicit vector_erase_front(const std::vector<K>& k) : keys(k), v(NULL) {}
+        void setup() { v = new V(keys.begin(), keys.end()); }
+        void run() { while (!v->empty()) v->erase(v->begin()); }
+        void teardown() { delete v; }
+    };
+
+    template <class V, class K>
+    struct vector_iterate
+    {
+        static const char* name() { return "iterate"; }
+        const std::vector<K>& keys;
+        V* v;
+        explicit vector_iterate(const std::vector<K>& k) : keys(k), v(NULL) {}
+        void setup() { v = new V(keys.begin(), keys.end()); }
+        void run()
+        {
+            std::size_t sum = 0;
+            for (typename V::const_iterator it = v->begin(); it != v->end(); ++it)
+                sum += checksum(*it);
+            g_sink = sum;
+        }
+        void teardown() { delete v; }
+    };
+
+    template <class V, class K>
+    struct vector_copy
+    {
+        static const char* name() { return "copy"; }
+        const std::vector<K>& keys;
+        V* v;
+        explicit vector_copy(const std::vector<K>& k) : keys(k), v(NULL) {}
+        void setup() { v = new V(keys.begin(), keys.end()); }
+        void run()
+        {
+            V copy(*v);
+            g_sink = copy.size();
+        }
+        void teardown() { delete v; }
+    };
+
+    // Every map in here maps to int.
+    template <class C, class K>
+    void fill(C& c, const std::vector<K>& keys)
+    {
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            c.insert(typename C::value_type(keys[i], 0));
+    }
+
+    template <class C, class K>
+    void fill_set(C& c, const std::vector<K>& keys)
+    {
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            c.insert(keys[i]);
+    }
+
+    template <class M, class K>
+    struct map_insert
+    {
+        static const char* name() { return "insert"; }
+        const std::vector<K>& keys;
+        M* m;
+        explicit map_insert(const std::vector<K>& k) : keys(k), m(NULL) {}
+        void setup() { m = new M; }
+        void run() { fill(*m, keys); }
+        void teardown() { delete m; }
+    };
+
+    template <class M, class K>
+    struct map_find
+    {
+        static const char* name() { return "find"; }
+        const std::vector<K>& keys;
+        M* m;
+        explicit map_find(const std::vector<K>& k) : keys(k), m(NULL) {}
+        void setup() { m = new M; fill(*m, keys); }
+        void run()
+        {
+            std::size_t hits = 0;
+            for (std::size_t i = keys.size(); i-- > 0; )
+                hits += (m->find(keys[i]) != m->end());
+            g_sink = hits;
+        }
+        void teardown() { delete m; }
+    };
+
+    template <class M, class K>
+    struct map_erase
+    {
+        static const char* name() { return "erase"; }
+        const std::vector<K>& keys;
+        M* m;
+        explicit map_erase(const std::vector<K>& k) : keys(k), m(NULL) {}
+        void setup() { m = new M; fill(*m, keys); }
+        void run() { for (std::size_t i = 0; i < keys.size(); ++i) m->erase(keys[i]); }
+        void teardown() { delete m; }
+    };
+
+    template <class M, class K>
+    struct map_iterate
+    {
+        static const char* name() { return "iterate"; }
+        const std::vector<K>& keys;
+        M* m;
+        explicit map_iterate(const std::vector<K>& k) : keys(k), m(NULL) {}
+        void setup() { m = new M; fill(*m, keys); }
+        void run()
+        {
+            std::size_t sum = 0;
+            for (typename M::const_iterator it = m->begin(); it != m->end(); ++it)
+                sum += checksum(it->first);
+            g_sink = sum;
+        }
+        void teardown() { delete m; }
+    };
+
+    template <class M, class K>
+    struct map_copy
+    {
+        static const char* name() { return "copy"; }
+        const std::vector<K>& keys;
+        M* m;
+        explicit map_copy(const std::vector<K>& k) : keys(k), m(NULL) {}
+        void setup() { m = new M; fill(*m, keys); }
+        void run()
+        {
+            M copy(*m);
+            g_sink = copy.size();
+        }
+        void teardown() { delete m; }
+    };
+
+    template <class S, class K>
+    struct set_insert
+    {
+        static const char* name() { return "insert"; }
+        const std::vector<K>& keys;
+        S* s;
+        explicit set_insert(const std::vector<K>& k) : keys(k), s(NULL) {}
+        void setup() { s = new S; }
+        void run() { fill_set(*s, keys); }
+        void teardown() { delete s; }
+    };
+
+    template <class S, class K>
+    struct set_find
+    {
+        static const char* name() { return "find"; }
+        const std::vector<K>& keys;
+        S* s;
+        explicit set_find(const std::vector<K>& k) : keys(k), s(NULL) {}
+        void setup() { s = new S; fill_set(*s, keys); }
+        void run()
+        {
+            std::size_t hits = 0;
+            for (std::size_t i = keys.size(); i-- > 0; )
+                hits += s->count(keys[i]);
+            g_sink = hits;
+        }
+        void teardown() { delete s; }
+    };
+
+    template <class S, class K>
+    struct set_erase
+    {
+        static const char* name() { return "erase"; }
+        const std::vector<K>& keys;
+        S* s;
+        explicit set_erase(const std::vector<K>& k) : keys(k), s(NULL) {}
+        void setup() { s = new S; fill_set(*s, keys); }
+        void run() { for (std::size_t i = 0; i < keys.size(); ++i) s->erase(keys[i]); }
+        void teardown() { delete s; }
+    };
+
+    template <class St, class K>
+    struct stack_push
+    {
+        static const char* name() { return "push"; }
+        const std::vector<K>& keys;
+        St* s;
+        explicit stack_push(const std::vector<K>& k) : keys(k), s(NULL) {}
+        void setup() { s = new St; }
+        void run() { for (std::size_t i = 0; i < keys.size(); ++i) s->push(keys[i]); }
+        void teardown() { delete s; }
+    };
+
+    template <class St, class K>
+    struct stack_pop
+    {
+        static const char* name() { return "pop"; }
+        const std::vector<K>& keys;
+        St* s;
+        explicit stack_pop(const std::vector<K>& k) : keys(k), s(NULL) {}
+        void setup()
+        {
+            s = new St;
+            for (std::size_t i = 0; i < keys.size(); ++i)
+                s->push(keys[i]);
+        }
+        void run()
+        {
+            std::size_t sum = 0;
+            while (!s->empty())
+            {
+                sum += checksum(s->top());
+                s->pop();
+            }
+            g_sink = sum;
+        }
+        void teardown() { delete s; }
+    };
+
+    /*              Driver          */
+
+    struct options
+    {
+        std::size_t max_size;
+        std::size_t min_ops;
+        int         trials;
+        const char* filter;
+        bool        csv;
+    };
+
+    options g_opt = { 1000000, 1000000, 3, NULL, false };
+
+    // Quadratic cases stop at this size.
+    const std::size_t quadratic_max = 10000;
+
+    struct sample
+    {
+        double      ns_per_op;
+        double      allocs_per_op;
+        std::size_t peak_heap;
+        long        peak_rss_kb;
+    };
+
+    template <class Case, class K>
+    sample measure(const std::vector<K>& keys)
+    {
+        std::size_t n = keys.size();
+        std::size_t runs = std::max<std::size_t>(1, g_opt.min_ops / n);
+        Case c(keys);
+        sample best = { 0, 0, 0, 0 };
+
+        reset_peak_rss();
+        long rss_base = read_status_kb("VmRSS:");
+        for (int trial = 0; trial < g_opt.trials; ++trial)
+        {
+            double ns = 0;
+            std::size_t allocs = 0;
+            std::size_t peak = 0;
+            for (std::size_t r = 0; r < runs; ++r)
+            {
+                c.setup();
+                std::size_t calls = g_alloc_calls;
+                std::size_t base = g_live_bytes;
+                g_peak_bytes = g_live_bytes;
+                std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+                c.run();
+                std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+                ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+                allocs += g_alloc_calls - calls;
+                peak = std::max(peak, g_peak_bytes - base);
+                c.teardown();
+            }
+            double per_op = ns / (double(runs) * n);
+            if (trial == 0 || per_op < best.ns_per_op)
+                best.ns_per_op = per_op;
+            best.allocs_per_op = double(allocs) / (double(runs) * n);
+            best.peak_heap = peak;
+        }
+        best.peak_rss_kb = std::max(0L, read_status_kb("VmHWM:") - rss_base);
+        return best;
+    }
+
+    std::string human_bytes(double bytes)
+    {
+        const char* units[] = { "B", "K", "M", "G", "T" };
+        int u = 0;
+        while (bytes >= 1024 && u < 4)
+        {
+            bytes /= 1024;
+            ++u;
+        }
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), u ? "%.1f%s" : "%.0f%s", bytes, units[u]);
+        return buf;
+    }
+
+    void print_header()
+    {
+        if (g_opt.csv)
+            std::printf("family,op,key,n,ft_ns_op,std_ns_op,ft_allocs_op,std_allocs_op,"
+                "ft_peak_heap,std_peak_heap,ft_peak_rss_kb,std_peak_rss_kb\n");
+        else
+            std::printf("%-13s %-17s %-7s %10s | %10s %10s %6s | %9s %9s | %8s %8s | %8s %8s\n",
+                "family", "op", "key", "n", "ft ns/op", "std ns/op", "ft/std",
+                "ft alloc", "std alloc", "ft heap", "std heap", "ft rss", "std rss");
+    }
+
+    template <template <class, class> class Case, class FtC, class StdC, class K>
+    void compare(const char* family, const char* key_name, const std::vector<K>& keys,
+        std::size_t max_size = std::size_t(-1))
+    {
+        typedef Case<FtC, K> ft_case;
+        typedef Case<StdC, K> std_case;
+
+        if (keys.size() > max_size)
+            return;
+        char label[128];
+        std::snprintf(label, sizeof(label), "%s/%s/%s", family, ft_case::name(), key_name);
+        if (g_opt.filter && !std::strstr(label, g_opt.filter))
+            return;
+
+        sample f = measure<ft_case>(keys);
+        sample s = measure<std_case>(keys);
+        if (g_opt.csv)
+            std::printf("%s,%s,%s,%zu,%.2f,%.2f,%.3f,%.3f,%zu,%zu,%ld,%ld\n",
+                family, ft_case::name(), key_name, keys.size(), f.ns_per_op, s.ns_per_op,
+                f.allocs_per_op, s.allocs_per_op, f.peak_heap, s.peak_heap,
+                f.peak_rss_kb, s.peak_rss_kb);
+        else
+            std::printf("%-13s %-17s %-7s %10zu | %10.1f %10.1f %6.2f | %9.3f %9.3f | %8s %8s | %8s %8s\n",
+                family, ft_case::name(), key_name, keys.size(), f.ns_per_op, s.ns_per_op,
+                s.ns_per_op > 0 ? f.ns_per_op / s.ns_per_op : 0.0,
+                f.allocs_per_op, s.allocs_per_op,
+                human_bytes(double(f.peak_heap)).c_str(), human_bytes(double(s.peak_heap)).c_str(),
+                human_bytes(f.peak_rss_kb * 1024.0).c_str(), human_bytes(s.peak_rss_kb * 1024.0).c_str());
+        std::fflush(stdout);
+    }
+
+    template <class K>
+    void run_key(const char* key_name, std::size_t n)
+    {
+        std::vector<K> keys;
+        make_keys(n, keys);
+
+        compare<vector_push_back, ft::vector<K>, std::vector<K> >("vector", key_name, keys);
+        compare<vector_reserve_push_back, ft::vector<K>, std::vector<K> >("vector", key_name, keys);
+        compare<vector_insert_front, ft::vector<K>, std::vector<K> >("vector", key_name, keys, quadratic_max);
+        compare<vector_erase_front, ft::vector<K>, std::vector<K> >("vector", key_name, keys, quadratic_max);
+        compare<vector_iterate, ft::vector<K>, std::vector<K> >("vector", key_name, keys);
+        compare<vector_copy, ft::vector<K>, std::vector<K> >("vector", key_name, keys);
+
+        compare<map_insert, ft::map<K, int>, std::map<K, int> >("map", key_name, keys);
+        compare<map_find, ft::map<K, int>, std::map<K, int> >("map", key_name, keys);
+        compare<map_erase, ft::map<K, int>, std::map<K, int> >("map", key_name, keys);
+        compare<map_iterate, ft::map<K, int>, std::map<K, int> >("map", key_name, keys);
+        compare<map_copy, ft::map<K, int>, std::map<K, int> >("map", key_name, keys);
+
+        compare<set_insert, ft::set<K>, std::set<K> >("set", key_name, keys);
+        compare<set_find, ft::set<K>, std::set<K> >("set", key_name, keys);
+        compare<set_erase, ft::set<K>, std::set<K> >("set", key_name, keys);
+
+        compare<stack_push, ft::stack<K>, std::stack<K> >("stack", key_name, keys);
+        compare<stack_pop, ft::stack<K>, std::stack<K> >("stack", key_name, keys);
+    }
+
+    // big_pod has no std::hash, so the hash maps only run on int and string.
+    template <class K>
+    void run_hash_key(const char* key_name, std::size_t n)
+    {
+        std::vector<K> keys;
+        make_keys(n, keys);
+
+        compare<map_insert, ft::unordered_map<K, int>, std::unordered_map<K, int> >("unordered_map", key_name, keys);
+        compare<map_find, ft::unordered_map<K, int>, std::unordered_map<K, int> >("unordered_map", key_name, keys);
+        compare<map_erase, ft::unordered_map<K, int>, std::unordered_map<K, int> >("unordered_map", key_name, keys);
+        compare<map_iterate, ft::unordered_map<K, int>, std::unordered_map<K, int> >("unordered_map", key_name, keys);
+    }
+
+    void usage(const char* prog)
+    {
+        std::fprintf(stderr, "usage: %s [--max-size N] [--min-ops N] [--trials N] [--filter TEXT] [--csv]\n", prog);
+        std::exit(2);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--csv")
+            g_opt.csv = true;
+        else if (i + 1 >= argc)
+            usage(argv[0]);
+        else if (arg == "--max-size")
+            g_opt.max_size = std::strtoul(argv[++i], NULL, 10);
+        else if (arg == "--min-ops")
+            g_opt.min_ops = std::strtoul(argv[++i], NULL, 10);
+        else if (arg == "--trials")
+            g_opt.trials = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--filter")
+            g_opt.filter = argv[++i];
+        else
+            usage(argv[0]);
+    }
+
+    print_header();
+    for (std::size_t n = 10; n <= g_opt.max_size; n *= 10)
+    {
+        run_key<int>("int", n);
+        run_key<std::string>("string", n);
+        run_key<big_pod>("big_pod", n);
+        run_hash_key<int>("int", n);
+        run_hash_key<std::string>("string", n);
+    }
+    std::printf("peak RSS of the whole run: %s\n",
+        human_bytes(read_status_kb("VmHWM:") * 1024.0).c_str());
+    return 0;
+}
@@ -2,100 +2,163 @@
 
 #include "iterator.hpp"
 #include "iterator_traits.hpp"
+#include <cstddef>
+#include <utility>
+
+/*
+** Links and color of a tree node. The color lives in the low bit of the
+** parent pointer. Leaves point to the shared, never written rb_nil()
+** sentinel; each tree embeds a header node, used as end(), whose parent
+** is the root and whose left and right links point to itself.
+*/
+struct rb_node_base
+{
+private:
+    std::size_t     _parent;
+
+public:
+    rb_node_base*   left;
+    rb_node_base*   right;
+
+    rb_node_base() : _parent(0), left(NULL), right(NULL) {}
+
+    rb_node_base* parent() const
+    {
+        return reinterpret_cast<rb_node_base*>(_parent & ~static_cast<std::size_t>(1));
+    }
+
+    void set_parent(rb_node_base* p)
+    {
+        _parent = reinterpret_cast<std::size_t>(p) | (_parent & 1);
+    }
+
+    bool is_red() const
+    {
+        return _parent & 1;
+    }
+
+    bool is_black() const
+    {
+        return !(_parent & 1);
+    }
+
+    void set_red()
+    {
+        _parent |= 1;
+    }
+
+    void set_black()
+    {
+        _parent &= ~static_cast<std::size_t>(1);
+    }
+
+    void copy_color(const rb_node_base* other)
+    {
+        _parent = (_parent & ~static_cast<std::size_t>(1)) | (other->_parent & 1);
+    }
+
+    bool is_nil() const;
+
+    bool is_header() const
+    {
+        return right == this;
+    }
+};
+
+template <class Dummy>
+struct rb_sentinel
+{
+    static rb_node_base nil;
+};
+
+template <class Dummy>
+rb_node_base rb_sentinel<Dummy>::nil;
+
+inline rb_node_base* rb_nil()
+{
+    return &rb_sentinel<void>::nil;
+}
+
+inline bool rb_node_base::is_nil() const
+{
+    return this == rb_nil();
+}
+
+// Selects the node constructors that build the element in place.
+struct rb_emplace_tag {};
 
 template <typename Key>
-struct Node
+struct Node : public rb_node_base
 {
     typedef Node<Key>*  NodePtr;
     typedef Key         value_type;
     typedef value_type& reference;
     typedef value_type* pointer;
-            
-    Key     key;
-    Node*   p;
-    Node*   left;
-    Node*   right;
-    char    c;
-    bool    is_nil;
 
+    Key     key;
 
-    Node(Key _key = Key(), Node *_p = NULL, Node *_left = NULL, Node *_right = NULL)
-        : key(_key), p(_p), left(_left), right(_right), c('R'), is_nil(false)   {}
-};
+    Node(const Key& _key = Key()) : key(_key)
+    {
+        set_red();
+    }
 
-template <typename T>
-static Node<T>* min_helper(Node<T>* x)
+#if __cplusplus >= 201103L
+    template <class... Args>
+    Node(rb_emplace_tag, Args&&... args) : key(std::forward<Args>(args)...)
     {
-        Node<T>* tmp = x;
-        if (tmp->is_nil)
-            return tmp;
-        while (!tmp->left->is_nil)
-        {
-            tmp = tmp->left;
-        }
-        return tmp;
+        set_red();
     }
+#endif
+};
 
+inline rb_node_base* min_helper(rb_node_base* x)
+{
+    if (x->is_nil())
+        return x;
+    while (!x->left->is_nil())
+        x = x->left;
+    return x;
+}
 
-template <typename T>
-Node<T>* max_helper(Node<T>* x)
+inline rb_node_base* max_helper(rb_node_base* x)
 {
-    Node<T>* tmp = x;
-    if (tmp->is_nil)
-            return tmp;
-    while (!tmp->right->is_nil)
-    {
-        tmp = tmp->right;
-    }
-    return tmp;
+    if (x->is_nil())
+        return x;
+    while (!x->right->is_nil())
+        x = x->right;
+    return x;
 }
 
-template <typename T>
-static Node<T>* increment(Node<T>* node)
+// Stepping past either end lands on the header; stepping from the header
+// wraps around to the other end.
+inline rb_node_base* increment(rb_node_base* x)
 {
-    Node<T>* base = node;
-    if (base->is_nil)
+    if (x->is_header())
+        return x->parent()->is_nil() ? x : min_helper(x->parent());
+    if (!x->right->is_nil())
+        return min_helper(x->right);
+    rb_node_base* y = x->parent();
+    while (x == y->right)
     {
-        base = base->p;
-        base = min_helper(base);
+        x = y;
+        y = y->parent();
     }
-    else if (base->right && !base->right->is_nil)
-			base = min_helper(base->right);
-		else
-		{
-			 Node<T>* node = base->p;
-			while (!base->is_nil && base == node->right)
-			{
-				base = node;
-				node = node->p;
-			}
-			base = node;
-		}
-		return base;
+    return y;
 }
 
-template <typename T>
-static Node<T>* decrement(Node<T>* node)
+inline rb_node_base* decrement(rb_node_base* x)
 {
-	Node<T>* _base = node;
-	if (_base->is_nil)
-	{
-		_base = _base->p;
-		_base = max_helper(_base);
-	}
-	else if (_base->left && !_base->left->is_nil)
-		_base = max_helper(_base->left);
-	else
-	{
-		Node<T>* node = _base->p;
-		while (!_base->is_nil && _base == node->left)
-		{
-			_base = node;
-			node = node->p;
-		}
-		_base = node;
-	}
-	return _base;
+    if (x->is_header())
+        return x->parent()->is_nil() ? x : max_helper(x->parent());
+    if (!x->left->is_nil())
+        return max_helper(x->left);
+    rb_node_base* y = x->parent();
+    while (x == y->left)
+    {
+        x = y;
+        y = y->parent();
+    }
+    return y;
 }
 
 
@@ -104,7 +167,7 @@ namespace ft
     template <typename T>
     class bidirectional_iterator : public ft::iterator <ft::bidirectional_iterator_tag, T> 
     {
-        typedef   Node<T>*                                                                  node_ptr;
+        typedef   rb_node_base*                                                             node_ptr;
         node_ptr ptr;
 
     public:
@@ -141,12 +204,12 @@ namespace ft
 
         T& operator* () const
         {
-            return (ptr->key);
+            return (static_cast<Node<T>*>(ptr)->key);
         }
 
         T* operator-> () const 
         {
-            return &(ptr->key);
+            return &(static_cast<Node<T>*>(ptr)->key);
         }
 
         bidirectional_iterator &operator++()
@@ -204,7 +267,7 @@ namespace ft
     template <typename T>
     class bidirectional_const_iterator : public ft::iterator <ft::bidirectional_iterator_tag, T> 
     {
-        typedef   Node<T>*                                                                  node_ptr;
+        typedef   rb_node_base*                                                             node_ptr;
         node_ptr ptr;
 
     public:
@@ -240,12 +303,12 @@ namespace ft
 
         const T& operator* () const
         {
-            return (ptr->key);
+            return (static_cast<Node<T>*>(ptr)->key);
         }
 
         const T* operator-> () const 
         {
-            return &(ptr->key);
+            return &(static_cast<Node<T>*>(ptr)->key);
         }
 
         bidirectional_const_iterator &operator++()
@@ -0,0 +1,946 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+#include "utility.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+
+namespace ft
+{
+    /*
+    ** B-tree core shared by btree_map and btree_set. Nodes hold as many
+    ** values as fit in about 256 bytes (four cache lines), so a lookup
+    ** does one dependent load per level of a tree that is several times
+    ** shallower than an RBT, and in-order scans walk arrays. Values live
+    ** in every node; leaves are allocated without the child array.
+    ** Inserting or erasing moves values between slots, so unlike RBT it
+    ** invalidates iterators.
+    */
+
+    // Values per node: what fits in node_bytes next to the node header.
+    template <class T>
+    struct btree_slots
+    {
+        enum { node_bytes = 256, header_bytes = 2 * sizeof(void*) };
+        enum { fit = (node_bytes - header_bytes) / sizeof(T) };
+        enum { value = fit < 3 ? 3 : fit };
+    };
+
+    template <class T, std::size_t Slots>
+    struct btree_node
+    {
+        btree_node*     parent;
+        unsigned short  position;   // index among the parent's children
+        unsigned short  count;
+        bool            leaf;
+        union
+        {
+            char        bytes[Slots * sizeof(T)];
+            long double align_ld;
+            long long   align_ll;
+            void*       align_p;
+        }               storage;
+
+        btree_node(bool is_leaf) : parent(NULL), position(0), count(0), leaf(is_leaf) {}
+
+        T& value(std::size_t i)
+        {
+            return reinterpret_cast<T*>(storage.bytes)[i];
+        }
+
+        const T& value(std::size_t i) const
+        {
+            return reinterpret_cast<const T*>(storage.bytes)[i];
+        }
+
+        T* values()
+        {
+            return reinterpret_cast<T*>(storage.bytes);
+        }
+
+        btree_node*& child(std::size_t i);
+        btree_node* child(std::size_t i) const;
+    };
+
+    template <class T, std::size_t Slots>
+    struct btree_internal_node : btree_node<T, Slots>
+    {
+        btree_node<T, Slots>* children[Slots + 1];
+
+        btree_internal_node() : btree_node<T, Slots>(false) {}
+    };
+
+    template <class T, std::size_t Slots>
+    btree_node<T, Slots>*& btree_node<T, Slots>::child(std::size_t i)
+    {
+        return static_cast<btree_internal_node<T, Slots>*>(this)->children[i];
+    }
+
+    template <class T, std::size_t Slots>
+    btree_node<T, Slots>* btree_node<T, Slots>::child(std::size_t i) const
+    {
+        return static_cast<const btree_internal_node<T, Slots>*>(this)->children[i];
+    }
+
+    /*              Iteration               */
+
+    // The end position is one past the last value of the rightmost leaf,
+    // so stepping off the last value climbs back down to it.
+    template <class T, std::size_t Slots>
+    void btree_increment(btree_node<T, Slots>*& n, int& pos)
+    {
+        if (!n->leaf)
+        {
+            n = n->child(pos + 1);
+            while (!n->leaf)
+                n = n->child(0);
+            pos = 0;
+            return;
+        }
+        if (++pos < n->count)
+            return;
+        btree_node<T, Slots>* save = n;
+        int save_pos = pos;
+        while (n->parent && pos == n->count)
+        {
+            pos = n->position;
+            n = n->parent;
+        }
+        if (pos == n->count)
+        {
+            n = save;
+            pos = save_pos;
+        }
+    }
+
+    template <class T, std::size_t Slots>
+    void btree_decrement(btree_node<T, Slots>*& n, int& pos)
+    {
+        if (!n->leaf)
+        {
+            n = n->child(pos);
+            while (!n->leaf)
+                n = n->child(n->count);
+            pos = n->count - 1;
+            return;
+        }
+        if (pos > 0)
+        {
+            --pos;
+            return;
+        }
+        while (n->parent && n->position == 0)
+            n = n->parent;
+        if (n->parent)
+        {
+            pos = n->position - 1;
+            n = n->parent;
+        }
+    }
+
+    template <typename T, std::size_t Slots>
+    class btree_iterator : public ft::iterator <ft::bidirectional_iterator_tag, T>
+    {
+        typedef btree_node<T, Slots>*   node_ptr;
+        node_ptr    node;
+        int         pos;
+
+    public:
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::iterator_category iterator_category;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::value_type        value_type;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::difference_type   difference_type;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::pointer           pointer;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::reference         reference;
+
+        btree_iterator() : node(NULL), pos(0) {}
+
+        btree_iterator(node_ptr n, int p) : node(n), pos(p) {}
+
+        node_ptr base() const
+        {
+            return node;
+        }
+
+        int index() const
+        {
+            return pos;
+        }
+
+        T& operator* () const
+        {
+            return node->value(pos);
+        }
+
+        T* operator-> () const
+        {
+            return &node->value(pos);
+        }
+
+        btree_iterator &operator++()
+        {
+            btree_increment(node, pos);
+            return *this;
+        }
+
+        btree_iterator operator++(int)
+        {
+            btree_iterator temp(*this);
+            btree_increment(node, pos);
+            return temp;
+        }
+
+        btree_iterator &operator--()
+        {
+            btree_decrement(node, pos);
+            return *this;
+        }
+
+        btree_iterator operator--(int)
+        {
+            btree_iterator temp(*this);
+            btree_decrement(node, pos);
+            return temp;
+        }
+
+        bool operator==(const btree_iterator &rhs) const
+        {
+            return node == rhs.node && pos == rhs.pos;
+        }
+
+        bool operator!=(const btree_iterator &rhs) const
+        {
+            return !(*this == rhs);
+        }
+    };
+
+    template <typename T, std::size_t Slots>
+    class btree_const_iterator : public ft::iterator <ft::bidirectional_iterator_tag, const T>
+    {
+        typedef btree_node<T, Slots>*   node_ptr;
+        node_ptr    node;
+        int         pos;
+
+    public:
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, const T>::iterator_category   iterator_category;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, const T>::value_type          value_type;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, const T>::difference_type     difference_type;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, const T>::pointer             pointer;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, const T>::reference           reference;
+
+        btree_const_iterator() : node(NULL), pos(0) {}
+
+        btree_const_iterator(node_ptr n, int p) : node(n), pos(p) {}
+
+        btree_const_iterator(const btree_iterator<T, Slots>& other)
+        : node(other.base()), pos(other.index()) {}
+
+        node_ptr base() const
+        {
+            return node;
+        }
+
+        int index() const
+        {
+            return pos;
+        }
+
+        const T& operator* () const
+        {
+            return node->value(pos);
+        }
+
+        const T* operator-> () const
+        {
+            return &node->value(pos);
+        }
+
+        btree_const_iterator &operator++()
+        {
+            btree_increment(node, pos);
+            return *this;
+        }
+
+        btree_const_iterator operator++(int)
+        {
+            btree_const_iterator temp(*this);
+            btree_increment(node, pos);
+            return temp;
+        }
+
+        btree_const_iterator &operator--()
+        {
+            btree_decrement(node, pos);
+            return *this;
+        }
+
+        btree_const_iterator operator--(int)
+        {
+            btree_const_iterator temp(*this);
+            btree_decrement(node, pos);
+            return temp;
+        }
+
+        bool operator==(const btree_const_iterator &rhs) const
+        {
+            return node == rhs.node && pos == rhs.pos;
+        }
+
+        bool operator!=(const btree_const_iterator &rhs) const
+        {
+            return !(*this == rhs);
+        }
+    };
+
+    template <typename T, std::size_t Slots>
+    bool operator==(const btree_iterator<T, Slots>& lhs, const btree_const_iterator<T, Slots>& rhs)
+    {
+        return btree_const_iterator<T, Slots>(lhs) == rhs;
+    }
+
+    template <typename T, std::size_t Slots>
+    bool operator!=(const btree_iterator<T, Slots>& lhs, const btree_const_iterator<T, Slots>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, class f_object, class Compare, class Allocator = std::allocator<T> >
+    class btree
+    {
+    public:
+        enum { slots = btree_slots<T>::value, min_count = (slots - 1) / 2 };
+
+        typedef typename f_object::key_type                 key_type;
+        typedef btree_node<T, slots>                        node_type;
+        typedef btree_iterator<T, slots>                    iterator;
+        typedef btree_const_iterator<T, slots>              const_iterator;
+
+    private:
+        typedef btree_internal_node<T, slots>                               internal_type;
+        typedef typename Allocator::template rebind<node_type>::other       leaf_allocator;
+        typedef typename Allocator::template rebind<internal_type>::other   internal_allocator;
+
+        node_type*          root;
+        node_type*          leftmost;
+        node_type*          rightmost;
+        std::size_t         _size;
+        Compare             compare;
+        f_object            access;
+        leaf_allocator      leaf_alloc;
+        internal_allocator  internal_alloc;
+
+    public:
+        btree(const Compare& comp = Compare())
+        : root(NULL), leftmost(NULL), rightmost(NULL), _size(0), compare(comp) {}
+
+        btree(const btree& other)
+        : root(NULL), leftmost(NULL), rightmost(NULL), _size(0), compare(other.compare)
+        {
+            copy_from(other);
+        }
+
+        btree& operator=(const btree& other)
+        {
+            if (this == &other)
+                return *this;
+            delete_all();
+            compare = other.compare;
+            copy_from(other);
+            return *this;
+        }
+
+#if __cplusplus >= 201103L
+        btree(btree&& other)
+        : root(NULL), leftmost(NULL), rightmost(NULL), _size(0), compare(other.compare)
+        {
+            swap(other);
+        }
+
+        btree& operator=(btree&& other)
+        {
+            if (this == &other)
+                return *this;
+            delete_all();
+            swap(other);
+            return *this;
+        }
+#endif
+
+        ~btree()
+        {
+            delete_all();
+        }
+
+        std::size_t size() const
+        {
+            return _size;
+        }
+
+        iterator begin() const
+        {
+            return iterator(leftmost, 0);
+        }
+
+        iterator end() const
+        {
+            return iterator(rightmost, rightmost ? rightmost->count : 0);
+        }
+
+        static T& value(iterator it)
+        {
+            return *it;
+        }
+
+        /*              Lookup              */
+
+        // Within a node the smallest value not below key is the answer
+        // unless a smaller one turns up in the child to its left.
+        iterator lower_bound(const key_type& key) const
+        {
+            iterator res = end();
+            node_type* n = root;
+            while (n)
+            {
+                int i = node_lower_bound(n, key);
+                if (i < n->count)
+                {
+                    res = iterator(n, i);
+                    if (!compare(key, access(n->value(i))))
+                        return res;
+                }
+                if (n->leaf)
+                    break;
+                n = n->child(i);
+            }
+            return res;
+        }
+
+        iterator upper_bound(const key_type& key) const
+        {
+            iterator res = end();
+            node_type* n = root;
+            while (n)
+            {
+                int i = node_upper_bound(n, key);
+                if (i < n->count)
+                    res = iterator(n, i);
+                if (n->leaf)
+                    break;
+                n = n->child(i);
+            }
+            return res;
+        }
+
+        iterator search(const key_type& key) const
+        {
+            node_type* n;
+            int i;
+            if (find_insert_position(key, n, i))
+                return iterator(n, i);
+            return end();
+        }
+
+        // Finds key, or the leaf slot where it would go when it is absent.
+        bool find_insert_position(const key_type& key, node_type*& n, int& i) const
+        {
+            n = root;
+            i = 0;
+            while (n)
+            {
+                i = node_lower_bound(n, key);
+                if (i < n->count && !compare(key, access(n->value(i))))
+                    return true;
+                if (n->leaf)
+                    return false;
+                n = n->child(i);
+            }
+            return false;
+        }
+
+        /*              Insertion               */
+
+        ft::pair<iterator, bool> insert_unique(const T& elem)
+        {
+            node_type* n;
+            int i;
+            if (find_insert_position(access(elem), n, i))
+                return ft::make_pair(iterator(n, i), false);
+            return ft::make_pair(insert_at(n, i, elem), true);
+        }
+
+        iterator insert_hint(iterator hint, const T& elem)
+        {
+            (void)hint;
+            return insert_unique(elem).first;
+        }
+
+        // Puts elem at the leaf slot found by find_insert_position,
+        // splitting full nodes on the way up.
+        iterator insert_at(node_type* n, int i, const T& elem)
+        {
+            make_room(n, i);
+            shift_right(n, i);
+            try
+            {
+                ::new (static_cast<void*>(&n->value(i))) T(elem);
+            }
+            catch (...)
+            {
+                undo_room(n, i);
+                throw;
+            }
+            return inserted(n, i);
+        }
+
+#if __cplusplus >= 201103L
+        iterator insert_at(node_type* n, int i, T&& elem)
+        {
+            make_room(n, i);
+            shift_right(n, i);
+            try
+            {
+                ::new (static_cast<void*>(&n->value(i))) T(std::move(elem));
+            }
+            catch (...)
+            {
+                undo_room(n, i);
+                throw;
+            }
+            return inserted(n, i);
+        }
+
+        ft::pair<iterator, bool> insert_unique(T&& elem)
+        {
+            node_type* n;
+            int i;
+            if (find_insert_position(access(elem), n, i))
+                return ft::make_pair(iterator(n, i), false);
+            return ft::make_pair(insert_at(n, i, std::move(elem)), true);
+        }
+
+        template <class... Args>
+        ft::pair<iterator, bool> emplace_unique(Args&&... args)
+        {
+            T tmp(std::forward<Args>(args)...);
+            return insert_unique(std::move(tmp));
+        }
+
+        template <class... Args>
+        iterator emplace_hint_unique(iterator hint, Args&&... args)
+        {
+            (void)hint;
+            return emplace_unique(std::forward<Args>(args)...).first;
+        }
+#endif
+
+        // Ascending input goes straight to the end of the rightmost leaf.
+        template <class InputIt>
+        void insert_range(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+            {
+                if (rightmost && compare(access(rightmost->value(rightmost->count - 1)), access(*first)))
+                    insert_at(rightmost, rightmost->count, *first);
+                else
+                    insert_unique(*first);
+            }
+        }
+
+        /*              Removal             */
+
+        // A value in an internal node is replaced by its predecessor, which
+        // always sits at the end of a leaf; the leaf is then rebalanced.
+        void erase(iterator pos)
+        {
+            node_type* n = pos.base();
+            int i = pos.index();
+            n->value(i).~T();
+            if (!n->leaf)
+            {
+                node_type* l = n->child(i);
+                while (!l->leaf)
+                    l = l->child(l->count);
+                relocate(&n->value(i), &l->value(l->count - 1));
+                n = l;
+            }
+            else
+                move_values(n->values() + i, n->values() + i + 1, n->count - i - 1);
+            n->count--;
+            _size--;
+            rebalance(n);
+        }
+
+        // Erasing shuffles values between nodes, so the range is walked by
+        // key: after each erase the next victim is the first value not
+        // below the first erased key.
+        void erase_range(iterator first, iterator last)
+        {
+            if (first == begin() && last == end())
+            {
+                delete_all();
+                return;
+            }
+            if (first == last)
+                return;
+            std::size_t n = 0;
+            for (iterator it = first; it != last; ++it)
+                n++;
+            key_type key = access(*first);
+            while (n--)
+                erase(lower_bound(key));
+        }
+
+        std::size_t erase_key(const key_type& key)
+        {
+            iterator it = search(key);
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+        void delete_all()
+        {
+            if (root)
+                delete_subtree(root);
+            root = leftmost = rightmost = NULL;
+            _size = 0;
+        }
+
+        void swap(btree& other)
+        {
+            std::swap(root, other.root);
+            std::swap(leftmost, other.leftmost);
+            std::swap(rightmost, other.rightmost);
+            std::swap(_size, other._size);
+            std::swap(compare, other.compare);
+            std::swap(leaf_alloc, other.leaf_alloc);
+            std::swap(internal_alloc, other.internal_alloc);
+        }
+
+    private:
+        int node_lower_bound(const node_type* n, const key_type& key) const
+        {
+            int lo = 0;
+            int hi = n->count;
+            while (lo < hi)
+            {
+                int mid = (lo + hi) / 2;
+                if (compare(access(n->value(mid)), key))
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo;
+        }
+
+        int node_upper_bound(const node_type* n, const key_type& key) const
+        {
+            int lo = 0;
+            int hi = n->count;
+            while (lo < hi)
+            {
+                int mid = (lo + hi) / 2;
+                if (!compare(key, access(n->value(mid))))
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo;
+        }
+
+        /*              Nodes               */
+
+        node_type* new_leaf()
+        {
+            node_type* n = leaf_alloc.allocate(1);
+            return ::new (static_cast<void*>(n)) node_type(true);
+        }
+
+        node_type* new_internal()
+        {
+            internal_type* n = internal_alloc.allocate(1);
+            return ::new (static_cast<void*>(n)) internal_type();
+        }
+
+        void free_node(node_type* n)
+        {
+            if (n->leaf)
+                leaf_alloc.deallocate(n, 1);
+            else
+                internal_alloc.deallocate(static_cast<internal_type*>(n), 1);
+        }
+
+        void delete_subtree(node_type* n)
+        {
+            if (!n->leaf)
+                for (int k = 0; k <= n->count; k++)
+                    delete_subtree(n->child(k));
+            for (int k = 0; k < n->count; k++)
+                n->value(k).~T();
+            free_node(n);
+        }
+
+        // Structural copy: same shape, no comparisons, no rebalancing.
+        node_type* clone(const node_type* src, node_type* parent)
+        {
+            node_type* n = src->leaf ? new_leaf() : new_internal();
+            n->parent = parent;
+            n->position = src->position;
+            int built = 0;
+            try
+            {
+                for (; n->count < src->count; n->count++)
+                    ::new (static_cast<void*>(&n->value(n->count))) T(src->value(n->count));
+                if (!src->leaf)
+                    for (; built <= src->count; built++)
+                        n->child(built) = clone(src->child(built), n);
+            }
+            catch (...)
+            {
+                for (int k = 0; k < built; k++)
+                    delete_subtree(n->child(k));
+                for (int k = 0; k < n->count; k++)
+                    n->value(k).~T();
+                free_node(n);
+                throw;
+            }
+            return n;
+        }
+
+        void copy_from(const btree& other)
+        {
+            if (!other.root)
+                return;
+            root = clone(other.root, NULL);
+            leftmost = root;
+            while (!leftmost->leaf)
+                leftmost = leftmost->child(0);
+            rightmost = root;
+            while (!rightmost->leaf)
+                rightmost = rightmost->child(rightmost->count);
+            _size = other._size;
+        }
+
+        /*              Moving values               */
+
+        static void relocate(T* dst, T* src)
+        {
+#if __cplusplus >= 201103L
+            ::new (static_cast<void*>(dst)) T(std::move(*src));
+#else
+            ::new (static_cast<void*>(dst)) T(*src);
+#endif
+            src->~T();
+        }
+
+        // Relocates n values between possibly overlapping slot ranges.
+        static void move_values(T* dst, T* src, int n)
+        {
+            if (n <= 0 || dst == src)
+                return;
+            if (is_trivially_relocatable<T>::value)
+            {
+                std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+                return;
+            }
+            if (dst < src)
+                for (int k = 0; k < n; k++)
+                    relocate(dst + k, src + k);
+            else
+                for (int k = n - 1; k >= 0; k--)
+                    relocate(dst + k, src + k);
+        }
+
+        static void shift_right(node_type* n, int i)
+        {
+            move_values(n->values() + i + 1, n->values() + i, n->count - i);
+        }
+
+        static void set_child(node_type* p, int k, node_type* c)
+        {
+            p->child(k) = c;
+            c->parent = p;
+            c->position = k;
+        }
+
+        /*              Insertion helpers               */
+
+        void make_room(node_type*& n, int& i)
+        {
+            if (!root)
+            {
+                root = leftmost = rightmost = new_leaf();
+                n = root;
+                i = 0;
+            }
+            if (n->count == slots)
+                split(n, i);
+        }
+
+        void undo_room(node_type* n, int i)
+        {
+            move_values(n->values() + i, n->values() + i + 1, n->count - i);
+            rebalance(n);
+        }
+
+        iterator inserted(node_type* n, int i)
+        {
+            n->count++;
+            _size++;
+            return iterator(n, i);
+        }
+
+        bool on_right_edge(const node_type* n) const
+        {
+            for (; n->parent; n = n->parent)
+                if (n->position != n->parent->count)
+                    return false;
+            return true;
+        }
+
+        // Splits the full node n around a median that moves up into the
+        // parent, splitting the parent first if it is full too, and moves
+        // the pending insert slot (n, i) to whichever half it falls in.
+        // Appending at the right edge keeps the left half full, so
+        // ascending inserts pack nodes instead of leaving them half empty.
+        void split(node_type*& n, int& i)
+        {
+            node_type* p = n->parent;
+            if (!p)
+            {
+                p = new_internal();
+                set_child(p, 0, n);
+                root = p;
+            }
+            else if (p->count == slots)
+            {
+                int k = n->position;
+                split(p, k);
+                p = n->parent;
+            }
+            int mid = (i == slots && on_right_edge(n)) ? slots - 1 : slots / 2;
+            node_type* s = n->leaf ? new_leaf() : new_internal();
+            move_values(s->values(), n->values() + mid + 1, slots - mid - 1);
+            s->count = slots - mid - 1;
+            if (!n->leaf)
+                for (int k = 0; k <= s->count; k++)
+                    set_child(s, k, n->child(mid + 1 + k));
+            int k = n->position;
+            shift_right(p, k);
+            for (int j = p->count; j > k; j--)
+                set_child(p, j + 1, p->child(j));
+            relocate(&p->value(k), &n->value(mid));
+            set_child(p, k + 1, s);
+            p->count++;
+            n->count = mid;
+            if (n == rightmost)
+                rightmost = s;
+            if (i > mid)
+            {
+                n = s;
+                i -= mid + 1;
+            }
+        }
+
+        /*              Removal helpers             */
+
+        // Refills an underfull node from a sibling that can spare a value,
+        // or merges it with one and carries on with the parent.
+        void rebalance(node_type* n)
+        {
+            while (n != root && n->count < min_count)
+            {
+                node_type* p = n->parent;
+                int k = n->position;
+                if (k > 0 && p->child(k - 1)->count > min_count)
+                {
+                    rotate_right(p, k - 1);
+                    return;
+                }
+                if (k < p->count && p->child(k + 1)->count > min_count)
+                {
+                    rotate_left(p, k);
+                    return;
+                }
+                if (k > 0)
+                    merge(p, k - 1);
+                else
+                    merge(p, k);
+                n = p;
+            }
+            if (root->count != 0)
+                return;
+            node_type* old = root;
+            if (root->leaf)
+                root = leftmost = rightmost = NULL;
+            else
+            {
+                root = root->child(0);
+                root->parent = NULL;
+                root->position = 0;
+            }
+            free_node(old);
+        }
+
+        // Moves the separator k down into the right child and the left
+        // child's last value up in its place.
+        void rotate_right(node_type* p, int k)
+        {
+            node_type* l = p->child(k);
+            node_type* r = p->child(k + 1);
+            shift_right(r, 0);
+            relocate(&r->value(0), &p->value(k));
+            relocate(&p->value(k), &l->value(l->count - 1));
+            if (!r->leaf)
+            {
+                for (int j = r->count + 1; j > 0; j--)
+                    set_child(r, j, r->child(j - 1));
+                set_child(r, 0, l->child(l->count));
+            }
+            r->count++;
+            l->count--;
+        }
+
+        void rotate_left(node_type* p, int k)
+        {
+            node_type* l = p->child(k);
+            node_type* r = p->child(k + 1);
+            relocate(&l->value(l->count), &p->value(k));
+            relocate(&p->value(k), &r->value(0));
+            move_values(r->values(), r->values() + 1, r->count - 1);
+            if (!l->leaf)
+            {
+                set_child(l, l->count + 1, r->child(0));
+                for (int j = 0; j < r->count; j++)
+                    set_child(r, j, r->child(j + 1));
+            }
+            l->count++;
+            r->count--;
+        }
+
+        // Folds the right child of separator k and the separator itself
+        // into the left child.
+        void merge(node_type* p, int k)
+        {
+            node_type* l = p->child(k);
+            node_type* r = p->child(k + 1);
+            relocate(&l->value(l->count), &p->value(k));
+            move_values(l->values() + l->count + 1, r->values(), r->count);
+            if (!l->leaf)
+                for (int j = 0; j <= r->count; j++)
+                    set_child(l, l->count + 1 + j, r->child(j));
+            l->count += 1 + r->count;
+            move_values(p->values() + k, p->values() + k + 1, p->count - k - 1);
+            for (int j = k + 1; j < p->count; j++)
+                set_child(p, j, p->child(j + 1));
+            p->count--;
+            if (r == rightmost)
+                rightmost = l;
+            free_node(r);
+        }
+    };
+}
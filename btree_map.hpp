@@ -0,0 +1,426 @@
+#pragma once
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include "reverse_iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "utility.hpp"
+#include "btree.hpp"
+
+namespace ft
+{
+    /*
+    ** map interface over a B-tree (see btree.hpp), for large maps where
+    ** lookups and in-order scans are bound by cache misses. The API is the
+    ** one of ft::map minus the order statistics; what callers can tell
+    ** apart is that inserting or erasing invalidates iterators.
+    */
+    template<
+        class Key,
+        class T,
+        class Compare = std::less<Key>,
+        class Allocator = std::allocator<ft::pair<const Key, T> >
+    > class btree_map
+    {
+    public:
+
+        typedef Key                                             key_type;
+        typedef T                                               mapped_value;
+        typedef ft::pair<const Key, T>                          value_type;
+        typedef std::size_t                                     size_type;
+        typedef std::ptrdiff_t                                  difference_type;
+        typedef Compare                                         key_compare;
+        typedef Allocator                                       allocator_type;
+        typedef value_type&                                     reference;
+        typedef const value_type&                               const_reference;
+        typedef typename Allocator::pointer                     pointer;
+        typedef typename Allocator::const_pointer               const_pointer;
+
+    private:
+
+        template <typename Type>
+        struct SelectFirst
+        {
+            typedef typename Type::first_type key_type;
+            key_type &operator()(Type &val)
+            {
+                return val.first;
+            }
+            const key_type &operator()(const Type &val) const
+            {
+                return val.first;
+            }
+        };
+
+        typedef btree<value_type, SelectFirst<value_type>, Compare, Allocator>  tree_type;
+        typedef typename tree_type::node_type                                   node_type;
+
+        tree_type                                           _tree;
+        allocator_type                                      _alloc;
+
+    public:
+        typedef typename tree_type::iterator                    iterator;
+        typedef typename tree_type::const_iterator              const_iterator;
+        typedef ft::reverse_iterator<iterator>                  reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+        /*              Constructors            */
+
+        btree_map() : _tree(Compare()) {}
+
+        explicit btree_map( const Compare& comp,
+            const Allocator& alloc = Allocator()) : _tree(comp), _alloc(alloc) {}
+
+        explicit btree_map( const Allocator& alloc ) : _tree(Compare()), _alloc(alloc) {}
+
+        template< class InputIt >
+        btree_map( InputIt first, InputIt last, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator(), typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+            : _tree(comp), _alloc(alloc)
+        {
+            _tree.insert_range(first, last);
+        }
+
+        btree_map( const btree_map& other )
+        : _tree(other._tree), _alloc(other._alloc) {}
+
+#if __cplusplus >= 201103L
+        btree_map( btree_map&& other )
+        : _tree(std::move(other._tree)), _alloc(other._alloc) {}
+#endif
+
+        btree_map& operator=( const btree_map& other )
+        {
+            _tree = other._tree;
+            return *this;
+        }
+
+#if __cplusplus >= 201103L
+        btree_map& operator=( btree_map&& other )
+        {
+            _tree = std::move(other._tree);
+            return *this;
+        }
+#endif
+
+        class value_compare
+        {
+            public:
+                value_compare(key_compare c) : _comp(c) {}
+
+                bool operator()(const value_type &lhs, const value_type &rhs) const
+                {
+                    return (this->_comp(lhs.first, rhs.first));
+                }
+
+            protected:
+                key_compare _comp;
+        };
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        /*              Element access          */
+
+        T& at( const Key& key )
+        {
+            iterator ret = _tree.search(key);
+            if (ret == _tree.end())
+                throw std::out_of_range("btree_map::at");
+            return ret->second;
+        }
+
+        const T& at( const Key& key ) const
+        {
+            iterator ret = _tree.search(key);
+            if (ret == _tree.end())
+                throw std::out_of_range("btree_map::at");
+            return ret->second;
+        }
+
+        T& operator[]( const Key& key )
+        {
+            return try_emplace(key).first->second;
+        }
+
+#if __cplusplus >= 201103L
+        T& operator[]( Key&& key )
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+#endif
+
+        /*              Iterators               */
+
+        iterator begin()
+        {
+            return _tree.begin();
+        }
+
+        const_iterator begin() const
+        {
+            return _tree.begin();
+        }
+
+        iterator end()
+        {
+            return _tree.end();
+        }
+
+        const_iterator end() const
+        {
+            return _tree.end();
+        }
+
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        /*              Capacity                */
+
+        bool empty() const
+        {
+            return _tree.size() == 0;
+        }
+
+        size_type size() const
+        {
+            return _tree.size();
+        }
+
+        size_type max_size() const
+        {
+            return _alloc.max_size();
+        }
+
+        /*              Modifiers               */
+
+        void clear()
+        {
+            _tree.delete_all();
+        }
+
+        ft::pair<iterator, bool> insert( const value_type& value )
+        {
+            return _tree.insert_unique(value);
+        }
+
+#if __cplusplus >= 201103L
+        ft::pair<iterator, bool> insert( value_type&& value )
+        {
+            return _tree.insert_unique(std::move(value));
+        }
+
+        template< class... Args >
+        ft::pair<iterator, bool> emplace( Args&&... args )
+        {
+            return _tree.emplace_unique(std::forward<Args>(args)...);
+        }
+
+        template< class... Args >
+        iterator emplace_hint( const_iterator hint, Args&&... args )
+        {
+            return _tree.emplace_hint_unique(iterator(hint.base(), hint.index()), std::forward<Args>(args)...);
+        }
+
+        // The mapped value is only built when key is not present yet.
+        template< class... Args >
+        ft::pair<iterator, bool> try_emplace( const Key& key, Args&&... args )
+        {
+            node_type* n;
+            int i;
+            if (_tree.find_insert_position(key, n, i))
+                return ft::make_pair(iterator(n, i), false);
+            return ft::make_pair(_tree.insert_at(n, i, value_type(key,
+                T(std::forward<Args>(args)...))), true);
+        }
+
+        template< class... Args >
+        ft::pair<iterator, bool> try_emplace( Key&& key, Args&&... args )
+        {
+            node_type* n;
+            int i;
+            if (_tree.find_insert_position(key, n, i))
+                return ft::make_pair(iterator(n, i), false);
+            return ft::make_pair(_tree.insert_at(n, i, value_type(std::move(key),
+                T(std::forward<Args>(args)...))), true);
+        }
+#else
+        ft::pair<iterator, bool> try_emplace( const Key& key )
+        {
+            node_type* n;
+            int i;
+            if (_tree.find_insert_position(key, n, i))
+                return ft::make_pair(iterator(n, i), false);
+            return ft::make_pair(_tree.insert_at(n, i, value_type(key, T())), true);
+        }
+
+        ft::pair<iterator, bool> try_emplace( const Key& key, const T& obj )
+        {
+            node_type* n;
+            int i;
+            if (_tree.find_insert_position(key, n, i))
+                return ft::make_pair(iterator(n, i), false);
+            return ft::make_pair(_tree.insert_at(n, i, value_type(key, obj)), true);
+        }
+#endif
+
+        iterator insert( iterator pos, const value_type& value )
+        {
+            return _tree.insert_hint(pos, value);
+        }
+
+        template< class InputIt >
+        void insert( InputIt first, InputIt last, typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+        {
+            _tree.insert_range(first, last);
+        }
+
+        void erase( iterator pos )
+        {
+            _tree.erase(pos);
+        }
+
+        void erase( iterator first, iterator last )
+        {
+            _tree.erase_range(first, last);
+        }
+
+        size_type erase( const Key& key )
+        {
+            return _tree.erase_key(key);
+        }
+
+        void swap( btree_map& other )
+        {
+            _tree.swap(other._tree);
+        }
+
+        /*              Lookup                  */
+
+        size_type count( const Key& key ) const
+        {
+            return (_tree.search(key) == _tree.end() ? 0 : 1);
+        }
+
+        iterator find( const Key& key )
+        {
+            return _tree.search(key);
+        }
+
+        const_iterator find( const Key& key ) const
+        {
+            return _tree.search(key);
+        }
+
+        ft::pair<iterator,iterator> equal_range( const Key& key )
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        iterator lower_bound( const Key& key )
+        {
+            return _tree.lower_bound(key);
+        }
+
+        const_iterator lower_bound( const Key& key ) const
+        {
+            return _tree.lower_bound(key);
+        }
+
+        iterator upper_bound( const Key& key )
+        {
+            return _tree.upper_bound(key);
+        }
+
+        const_iterator upper_bound( const Key& key ) const
+        {
+            return _tree.upper_bound(key);
+        }
+
+        /*              Observers               */
+
+        key_compare key_comp() const
+        {
+            return key_compare();
+        }
+
+        value_compare value_comp() const
+        {
+            return (value_compare(key_compare()));
+        }
+    };
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator==( const ft::btree_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator!=( const ft::btree_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return !(lhs == rhs);
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator<( const ft::btree_map<Key,T,Compare,Alloc>& lhs,
+                const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator>( const ft::btree_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return rhs < lhs;
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator<=( const ft::btree_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return !(lhs > rhs);
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator>=( const ft::btree_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return !(lhs < rhs);
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    void swap( ft::btree_map<Key,T,Compare,Alloc>& lhs,
+           ft::btree_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return lhs.swap(rhs);
+    }
+}
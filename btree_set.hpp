@@ -0,0 +1,301 @@
+#pragma once
+
+#include <memory>
+#include <functional>
+#include "reverse_iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "utility.hpp"
+#include "btree.hpp"
+
+namespace ft
+{
+    /*
+    ** set interface over a B-tree (see btree.hpp). Same API as ft::set
+    ** minus the order statistics; inserting or erasing invalidates
+    ** iterators.
+    */
+    template<class Key, class Compare = std::less<Key>,
+        class Allocator = std::allocator<Key> >
+    class btree_set
+    {
+    public:
+        typedef Key                                             key_type;
+        typedef Key                                             value_type;
+        typedef std::size_t                                     size_type;
+        typedef std::ptrdiff_t                                  difference_type;
+        typedef Compare                                         key_compare;
+        typedef Compare                                         value_compare;
+        typedef Allocator                                       allocator_type;
+        typedef value_type&                                     reference;
+        typedef const value_type&                               const_reference;
+        typedef typename Allocator::pointer                     pointer;
+        typedef typename Allocator::const_pointer               const_pointer;
+
+    private:
+
+        template <typename T>
+        struct Identity
+        {
+            typedef T key_type;
+            T &operator()(T &val)
+            {
+                return val;
+            }
+
+            const T &operator()(const T &val) const
+            {
+                return val;
+            }
+        };
+
+        typedef btree<value_type, Identity<value_type>, Compare, Allocator>    tree_type;
+        typedef typename tree_type::iterator                                    tree_iterator;
+
+        tree_type                                           _tree;
+        allocator_type                                      _alloc;
+
+    public:
+        typedef typename tree_type::const_iterator              iterator;
+        typedef typename tree_type::const_iterator              const_iterator;
+        typedef ft::reverse_iterator<const_iterator>            reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+        /*              Constructors            */
+
+        btree_set() : _tree(Compare()) {}
+
+        explicit btree_set( const Compare& comp,
+            const Allocator& alloc = Allocator() ) : _tree(comp), _alloc(alloc) {}
+
+        template< class InputIt >
+        btree_set( InputIt first, InputIt last, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator(),
+            typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+            : _tree(comp), _alloc(alloc)
+        {
+            _tree.insert_range(first, last);
+        }
+
+        btree_set( const btree_set& other )
+        : _tree(other._tree), _alloc(other._alloc) {}
+
+#if __cplusplus >= 201103L
+        btree_set( btree_set&& other )
+        : _tree(std::move(other._tree)), _alloc(other._alloc) {}
+#endif
+
+        btree_set& operator=( const btree_set& other )
+        {
+            _tree = other._tree;
+            return *this;
+        }
+
+#if __cplusplus >= 201103L
+        btree_set& operator=( btree_set&& other )
+        {
+            _tree = std::move(other._tree);
+            return *this;
+        }
+#endif
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        /*              Iterators               */
+
+        iterator begin() const
+        {
+            return _tree.begin();
+        }
+
+        iterator end() const
+        {
+            return _tree.end();
+        }
+
+        reverse_iterator rbegin() const
+        {
+            return reverse_iterator(end());
+        }
+
+        reverse_iterator rend() const
+        {
+            return reverse_iterator(begin());
+        }
+
+        /*              Capacity            */
+
+        bool empty() const
+        {
+            return _tree.size() == 0;
+        }
+
+        size_type size() const
+        {
+            return _tree.size();
+        }
+
+        size_type max_size() const
+        {
+            return _alloc.max_size();
+        }
+
+        /*              Modifiers           */
+
+        void clear()
+        {
+            _tree.delete_all();
+        }
+
+        ft::pair<iterator, bool> insert( const value_type& value )
+        {
+            ft::pair<tree_iterator, bool> ret = _tree.insert_unique(value);
+            return ft::make_pair(iterator(ret.first), ret.second);
+        }
+
+#if __cplusplus >= 201103L
+        ft::pair<iterator, bool> insert( value_type&& value )
+        {
+            ft::pair<tree_iterator, bool> ret = _tree.insert_unique(std::move(value));
+            return ft::make_pair(iterator(ret.first), ret.second);
+        }
+
+        template< class... Args >
+        ft::pair<iterator, bool> emplace( Args&&... args )
+        {
+            ft::pair<tree_iterator, bool> ret = _tree.emplace_unique(std::forward<Args>(args)...);
+            return ft::make_pair(iterator(ret.first), ret.second);
+        }
+
+        template< class... Args >
+        iterator emplace_hint( const_iterator hint, Args&&... args )
+        {
+            return _tree.emplace_hint_unique(unconst(hint), std::forward<Args>(args)...);
+        }
+#endif
+
+        iterator insert( iterator pos, const value_type& value )
+        {
+            return _tree.insert_hint(unconst(pos), value);
+        }
+
+        template< class InputIt >
+        void insert( InputIt first, InputIt last, typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+        {
+            _tree.insert_range(first, last);
+        }
+
+        void erase( iterator pos )
+        {
+            _tree.erase(unconst(pos));
+        }
+
+        void erase( iterator first, iterator last )
+        {
+            _tree.erase_range(unconst(first), unconst(last));
+        }
+
+        size_type erase( const Key& key )
+        {
+            return _tree.erase_key(key);
+        }
+
+        void swap( btree_set& other )
+        {
+            _tree.swap(other._tree);
+        }
+
+        size_type count( const Key& key ) const
+        {
+            return (_tree.search(key) == _tree.end() ? 0 : 1);
+        }
+
+        iterator find( const Key& key ) const
+        {
+            return _tree.search(key);
+        }
+
+        ft::pair<iterator,iterator> equal_range( const Key& key ) const
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        iterator lower_bound( const Key& key ) const
+        {
+            return _tree.lower_bound(key);
+        }
+
+        iterator upper_bound( const Key& key ) const
+        {
+            return _tree.upper_bound(key);
+        }
+
+        key_compare key_comp() const
+        {
+            return key_compare();
+        }
+
+        value_compare value_comp() const
+        {
+            return (value_compare());
+        }
+
+    private:
+        static tree_iterator unconst( const_iterator it )
+        {
+            return tree_iterator(it.base(), it.index());
+        }
+    };
+
+    template< class Key, class Compare, class Alloc >
+    bool operator==( const ft::btree_set<Key,Compare,Alloc>& lhs,
+                 const ft::btree_set<Key,Compare,Alloc>& rhs )
+    {
+        return ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template< class Key, class Compare, class Alloc >
+    bool operator!=( const ft::btree_set<Key,Compare,Alloc>& lhs,
+                 const ft::btree_set<Key,Compare,Alloc>& rhs )
+    {
+        return !(lhs == rhs);
+    }
+
+    template< class Key, class Compare, class Alloc >
+    bool operator<( const ft::btree_set<Key,Compare,Alloc>& lhs,
+                const ft::btree_set<Key,Compare,Alloc>& rhs )
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template< class Key, class Compare, class Alloc >
+    bool operator>( const ft::btree_set<Key,Compare,Alloc>& lhs,
+                 const ft::btree_set<Key,Compare,Alloc>& rhs )
+    {
+        return rhs < lhs;
+    }
+
+    template< class Key, class Compare, class Alloc >
+    bool operator<=( const ft::btree_set<Key,Compare,Alloc>& lhs,
+                 const ft::btree_set<Key,Compare,Alloc>& rhs )
+    {
+        return !(lhs > rhs);
+    }
+
+    template< class Key, class Compare, class Alloc >
+    bool operator>=( const ft::btree_set<Key,Compare,Alloc>& lhs,
+                 const ft::btree_set<Key,Compare,Alloc>& rhs )
+    {
+        return !(lhs < rhs);
+    }
+
+    template< class Key, class Compare, class Alloc >
+    void swap( ft::btree_set<Key,Compare,Alloc>& lhs,
+           ft::btree_set<Key,Compare,Alloc>& rhs )
+    {
+        return lhs.swap(rhs);
+    }
+}
@@ -0,0 +1,367 @@
+#pragma once
+
+#if __cplusplus >= 201103L
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "persistent_map.hpp"
+
+namespace ft
+{
+    /*
+    ** Ordered map for many readers and few writers. Readers never lock
+    ** nor wait: they read the current version, a persistent_map whose
+    ** nodes are never written once published. Writers take one mutex,
+    ** apply the change to their own copy (which copies only the O(log n)
+    ** nodes on its path) and publish that as the next version with one
+    ** atomic store.
+    **
+    ** Replaced versions are reclaimed by epochs: a reader announces the
+    ** epoch it started in, in a slot of its own cache line, and a version
+    ** retired at epoch e is freed once no reader announces e or earlier.
+    **
+    ** Lookups return copies, or hand the element to a functor while the
+    ** version is held; snapshot() gives a version to iterate at leisure.
+    */
+    template<
+        class Key,
+        class T,
+        class Compare = std::less<Key>,
+        class Allocator = std::allocator<ft::pair<const Key, T> >
+    > class concurrent_map
+    {
+    public:
+
+        typedef Key                                             key_type;
+        typedef T                                               mapped_value;
+        typedef ft::pair<const Key, T>                          value_type;
+        typedef std::size_t                                     size_type;
+        typedef Compare                                         key_compare;
+        typedef Allocator                                       allocator_type;
+        typedef ft::persistent_map<Key, T, Compare, Allocator>  snapshot_type;
+
+    private:
+        // One reader announcement, alone on its cache lines.
+        struct slot
+        {
+            std::atomic<std::size_t>    epoch;  // 0 when unused
+            char                        pad[128 - sizeof(std::atomic<std::size_t>)];
+
+            slot() : epoch(0) {}
+        };
+
+        struct retired
+        {
+            const snapshot_type*    version;
+            std::size_t             epoch;
+        };
+
+        // Pins the current version for the lifetime of the guard.
+        class read_guard
+        {
+        public:
+            explicit read_guard(const concurrent_map& map)
+            : _slot(map.enter()), _version(map._published.load()) {}
+
+            ~read_guard()
+            {
+                _slot.epoch.store(0, std::memory_order_release);
+            }
+
+            read_guard(const read_guard&) = delete;
+            read_guard& operator=(const read_guard&) = delete;
+
+            const snapshot_type& operator*() const
+            {
+                return *_version;
+            }
+
+            const snapshot_type* operator->() const
+            {
+                return _version;
+            }
+
+        private:
+            slot&                   _slot;
+            const snapshot_type*    _version;
+        };
+
+        snapshot_type                       _master;
+        mutable std::vector<slot>           _slots;
+        std::vector<retired>                _retired;
+        std::atomic<std::size_t>            _epoch;
+        std::atomic<const snapshot_type*>   _published;
+        std::mutex                          _write_mutex;
+
+    public:
+        /*              Constructors            */
+
+        explicit concurrent_map( const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+        : _master(comp, alloc), _slots(slot_count()), _epoch(1),
+          _published(new snapshot_type(_master)) {}
+
+        concurrent_map(const concurrent_map&) = delete;
+        concurrent_map& operator=(const concurrent_map&) = delete;
+
+        /*             Destructor          */
+
+        // No reader may be running.
+        ~concurrent_map()
+        {
+            delete _published.load();
+            for (std::size_t i = 0; i < _retired.size(); i++)
+                delete _retired[i].version;
+        }
+
+        /*              Lookup              */
+
+        bool find( const Key& key, T& value ) const
+        {
+            read_guard version(*this);
+            typename snapshot_type::const_iterator it = version->find(key);
+            if (it == version->end())
+                return false;
+            value = it->second;
+            return true;
+        }
+
+        size_type count( const Key& key ) const
+        {
+            read_guard version(*this);
+            return version->count(key);
+        }
+
+        // Calls f(element) for the element of key, if there is one, while
+        // it is safe to read.
+        template <class F>
+        bool visit( const Key& key, F f ) const
+        {
+            read_guard version(*this);
+            typename snapshot_type::const_iterator it = version->find(key);
+            if (it == version->end())
+                return false;
+            f(*it);
+            return true;
+        }
+
+        // Same with the first element not before key.
+        template <class F>
+        bool visit_lower_bound( const Key& key, F f ) const
+        {
+            read_guard version(*this);
+            typename snapshot_type::const_iterator it = version->lower_bound(key);
+            if (it == version->end())
+                return false;
+            f(*it);
+            return true;
+        }
+
+        // Same with the first element after key.
+        template <class F>
+        bool visit_upper_bound( const Key& key, F f ) const
+        {
+            read_guard version(*this);
+            typename snapshot_type::const_iterator it = version->upper_bound(key);
+            if (it == version->end())
+                return false;
+            f(*it);
+            return true;
+        }
+
+        // The current version, to iterate or query consistently; it does
+        // not see later writes.
+        snapshot_type snapshot() const
+        {
+            read_guard version(*this);
+            return *version;
+        }
+
+        /*             Capacity                */
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        size_type size() const
+        {
+            read_guard version(*this);
+            return version->size();
+        }
+
+        /*              Modifiers           */
+
+        bool insert( const value_type& value )
+        {
+            std::lock_guard<std::mutex> lock(_write_mutex);
+            bool inserted;
+            try
+            {
+                inserted = _master.insert(value).second;
+            }
+            catch (...)
+            {
+                rollback();
+                throw;
+            }
+            if (inserted)
+                publish();
+            return inserted;
+        }
+
+        // True when key was not there yet.
+        bool insert_or_assign( const Key& key, const T& value )
+        {
+            std::lock_guard<std::mutex> lock(_write_mutex);
+            bool inserted = _master.count(key) == 0;
+            try
+            {
+                _master[key] = value;
+            }
+            catch (...)
+            {
+                rollback();
+                throw;
+            }
+            publish();
+            return inserted;
+        }
+
+        size_type erase( const Key& key )
+        {
+            std::lock_guard<std::mutex> lock(_write_mutex);
+            size_type erased;
+            try
+            {
+                erased = _master.erase(key);
+            }
+            catch (...)
+            {
+                rollback();
+                throw;
+            }
+            if (erased)
+                publish();
+            return erased;
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(_write_mutex);
+            _master.clear();
+            publish();
+        }
+
+        // Runs f(snapshot_type&) on the writer's copy and publishes the
+        // result as one version: readers see all of it or none. If f
+        // throws, nothing is published.
+        template <class F>
+        void modify( F f )
+        {
+            std::lock_guard<std::mutex> lock(_write_mutex);
+            try
+            {
+                f(_master);
+            }
+            catch (...)
+            {
+                rollback();
+                throw;
+            }
+            publish();
+        }
+
+        /*              Observers               */
+
+        key_compare key_comp() const
+        {
+            return _master.key_comp();
+        }
+
+    private:
+        static std::size_t slot_count()
+        {
+            std::size_t n = 2 * std::thread::hardware_concurrency();
+            return n < 64 ? 64 : n;
+        }
+
+        // Spreads threads over the slots.
+        static std::size_t reader_index()
+        {
+            static std::atomic<std::size_t> next(0);
+            static thread_local std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+
+        // Claims a free slot with the current epoch. The claim is ordered
+        // before the read of the version (both sequentially consistent),
+        // so a writer that retires a version after this reader could have
+        // read it sees the claim.
+        slot& enter() const
+        {
+            std::size_t i = reader_index() % _slots.size();
+            for (;;)
+            {
+                std::size_t expected = 0;
+                if (_slots[i].epoch.compare_exchange_strong(expected, _epoch.load()))
+                    return _slots[i];
+                i = (i + 1) % _slots.size();
+            }
+        }
+
+        // Writer lock held: back to the published version.
+        void rollback()
+        {
+            _master = *_published.load();
+        }
+
+        // Writer lock held: makes _master the current version and frees
+        // the versions no reader can still be reading.
+        void publish()
+        {
+            snapshot_type* next;
+            try
+            {
+                _retired.reserve(_retired.size() + 1);
+                next = new snapshot_type(_master);
+            }
+            catch (...)
+            {
+                rollback();
+                throw;
+            }
+            retired old;
+            old.version = _published.exchange(next);
+            old.epoch = _epoch.fetch_add(1);
+            _retired.push_back(old);
+            reclaim();
+        }
+
+        void reclaim()
+        {
+            std::size_t oldest = _epoch.load();
+            for (std::size_t i = 0; i < _slots.size(); i++)
+            {
+                std::size_t e = _slots[i].epoch.load();
+                if (e != 0 && e < oldest)
+                    oldest = e;
+            }
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < _retired.size(); i++)
+            {
+                if (_retired[i].epoch < oldest)
+                    delete _retired[i].version;
+                else
+                    _retired[kept++] = _retired[i];
+            }
+            _retired.resize(kept);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,461 @@
+#pragma once
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include "reverse_iterator.hpp"
+#include "random_access_iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "utility.hpp"
+#include "flat_tree.hpp"
+
+namespace ft
+{
+    /*
+    ** map interface over a sorted ft::vector (see flat_tree.hpp). Meant for
+    ** tables that are built once, preferably through the range constructor
+    ** or range insert, and then queried: lookups touch a few cache lines
+    ** instead of chasing node pointers. Any insert or erase invalidates
+    ** iterators. Elements are stored as ft::pair<Key, T> so the vector can
+    ** move them around; changing a key through an iterator breaks the map.
+    */
+    template<
+        class Key,
+        class T,
+        class Compare = std::less<Key>,
+        class Allocator = std::allocator<ft::pair<Key, T> >
+    > class flat_map
+    {
+    public:
+        typedef Key                                                 key_type;
+        typedef T                                                   mapped_value;
+        typedef ft::pair<Key, T>                                    value_type;
+        typedef std::size_t                                         size_type;
+        typedef std::ptrdiff_t                                      difference_type;
+        typedef Compare                                             key_compare;
+        typedef Allocator                                           allocator_type;
+        typedef value_type&                                         reference;
+        typedef const value_type&                                   const_reference;
+        typedef typename Allocator::pointer                         pointer;
+        typedef typename Allocator::const_pointer                   const_pointer;
+        typedef ft::random_access_iterator<value_type>              iterator;
+        typedef ft::random_access_iterator<const value_type>        const_iterator;
+        typedef ft::reverse_iterator<iterator>                      reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                const_reverse_iterator;
+
+    private:
+
+        template <typename Type>
+        struct SelectFirst
+        {
+            typedef typename Type::first_type key_type;
+            key_type &operator()(Type &val)
+            {
+                return val.first;
+            }
+            const key_type &operator()(const Type &val) const
+            {
+                return val.first;
+            }
+        };
+
+        flat_tree<value_type, SelectFirst<value_type>, Compare, Allocator>  _tree;
+        allocator_type                                                      _alloc;
+
+    public:
+        /*              Constructors            */
+
+        flat_map() : _tree(Compare()) {}
+
+        explicit flat_map( const Compare& comp,
+            const Allocator& alloc = Allocator() ) : _tree(comp, alloc), _alloc(alloc) {}
+
+        explicit flat_map( const Allocator& alloc ) : _tree(Compare(), alloc), _alloc(alloc) {}
+
+        template< class InputIt >
+        flat_map( InputIt first, InputIt last, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator(),
+            typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+            : _tree(comp, alloc), _alloc(alloc)
+        {
+            _tree.insert_range(first, last);
+        }
+
+        class value_compare
+        {
+            public:
+                value_compare(key_compare c) : _comp(c) {}
+
+                bool operator()(const value_type &lhs, const value_type &rhs) const
+                {
+                    return (this->_comp(lhs.first, rhs.first));
+                }
+
+            protected:
+                key_compare _comp;
+        };
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        /*              Element access          */
+
+        T& at( const Key& key )
+        {
+            size_type i = _tree.search(key);
+            if (i == _tree.size())
+                throw std::out_of_range("flat_map::at");
+            return _tree.value(i).second;
+        }
+
+        const T& at( const Key& key ) const
+        {
+            size_type i = _tree.search(key);
+            if (i == _tree.size())
+                throw std::out_of_range("flat_map::at");
+            return _tree.value(i).second;
+        }
+
+        T& operator[]( const Key& key )
+        {
+            return try_emplace(key).first->second;
+        }
+
+#if __cplusplus >= 201103L
+        T& operator[]( Key&& key )
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+#endif
+
+        /*              Iterators               */
+
+        iterator begin()
+        {
+            return iterator(_tree.data());
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(_tree.data());
+        }
+
+        iterator end()
+        {
+            return iterator(_tree.data() + _tree.size());
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(_tree.data() + _tree.size());
+        }
+
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        /*              Capacity                */
+
+        bool empty() const
+        {
+            return _tree.size() == 0;
+        }
+
+        size_type size() const
+        {
+            return _tree.size();
+        }
+
+        size_type max_size() const
+        {
+            return _alloc.max_size();
+        }
+
+        size_type capacity() const
+        {
+            return _tree.capacity();
+        }
+
+        void reserve( size_type n )
+        {
+            _tree.reserve(n);
+        }
+
+        /*              Modifiers               */
+
+        void clear()
+        {
+            _tree.delete_all();
+        }
+
+        ft::pair<iterator, bool> insert( const value_type& value )
+        {
+            ft::pair<size_type, bool> ret = _tree.insert_unique(value);
+            return ft::make_pair(at_index(ret.first), ret.second);
+        }
+
+#if __cplusplus >= 201103L
+        ft::pair<iterator, bool> insert( value_type&& value )
+        {
+            ft::pair<size_type, bool> ret = _tree.insert_unique(std::move(value));
+            return ft::make_pair(at_index(ret.first), ret.second);
+        }
+
+        template< class... Args >
+        ft::pair<iterator, bool> emplace( Args&&... args )
+        {
+            ft::pair<size_type, bool> ret = _tree.emplace_unique(std::forward<Args>(args)...);
+            return ft::make_pair(at_index(ret.first), ret.second);
+        }
+
+        template< class... Args >
+        iterator emplace_hint( const_iterator hint, Args&&... args )
+        {
+            return at_index(_tree.emplace_hint_unique(index_of(hint), std::forward<Args>(args)...));
+        }
+
+        // The mapped value is only built when key is not present yet.
+        template< class... Args >
+        ft::pair<iterator, bool> try_emplace( const Key& key, Args&&... args )
+        {
+            size_type i = _tree.lower_bound(key);
+            if (_tree.holds(i, key))
+                return ft::make_pair(at_index(i), false);
+            return ft::make_pair(at_index(_tree.emplace_at(i, key,
+                T(std::forward<Args>(args)...))), true);
+        }
+
+        template< class... Args >
+        ft::pair<iterator, bool> try_emplace( Key&& key, Args&&... args )
+        {
+            size_type i = _tree.lower_bound(key);
+            if (_tree.holds(i, key))
+                return ft::make_pair(at_index(i), false);
+            return ft::make_pair(at_index(_tree.emplace_at(i, std::move(key),
+                T(std::forward<Args>(args)...))), true);
+        }
+#else
+        ft::pair<iterator, bool> try_emplace( const Key& key )
+        {
+            size_type i = _tree.lower_bound(key);
+            if (_tree.holds(i, key))
+                return ft::make_pair(at_index(i), false);
+            return ft::make_pair(at_index(_tree.insert_at(i, value_type(key, T()))), true);
+        }
+
+        ft::pair<iterator, bool> try_emplace( const Key& key, const T& obj )
+        {
+            size_type i = _tree.lower_bound(key);
+            if (_tree.holds(i, key))
+                return ft::make_pair(at_index(i), false);
+            return ft::make_pair(at_index(_tree.insert_at(i, value_type(key, obj))), true);
+        }
+#endif
+
+        iterator insert( const_iterator pos, const value_type& value )
+        {
+            return at_index(_tree.insert_hint(index_of(pos), value));
+        }
+
+        template< class InputIt >
+        void insert( InputIt first, InputIt last, typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+        {
+            _tree.insert_range(first, last);
+        }
+
+        iterator erase( const_iterator pos )
+        {
+            size_type i = index_of(pos);
+            _tree.erase_at(i);
+            return at_index(i);
+        }
+
+        iterator erase( const_iterator first, const_iterator last )
+        {
+            size_type i = index_of(first);
+            _tree.erase_range(i, index_of(last));
+            return at_index(i);
+        }
+
+        size_type erase( const Key& key )
+        {
+            size_type i = _tree.search(key);
+            if (i == _tree.size())
+                return 0;
+            _tree.erase_at(i);
+            return 1;
+        }
+
+        void swap( flat_map& other )
+        {
+            _tree.swap(other._tree);
+            std::swap(_alloc, other._alloc);
+        }
+
+        /*              Lookup                  */
+
+        size_type count( const Key& key ) const
+        {
+            return _tree.search(key) == _tree.size() ? 0 : 1;
+        }
+
+        iterator find( const Key& key )
+        {
+            return at_index(_tree.search(key));
+        }
+
+        const_iterator find( const Key& key ) const
+        {
+            return at_index(_tree.search(key));
+        }
+
+        ft::pair<iterator,iterator> equal_range( const Key& key )
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        iterator lower_bound( const Key& key )
+        {
+            return at_index(_tree.lower_bound(key));
+        }
+
+        const_iterator lower_bound( const Key& key ) const
+        {
+            return at_index(_tree.lower_bound(key));
+        }
+
+        iterator upper_bound( const Key& key )
+        {
+            return at_index(_tree.upper_bound(key));
+        }
+
+        const_iterator upper_bound( const Key& key ) const
+        {
+            return at_index(_tree.upper_bound(key));
+        }
+
+        /*              Order statistics        */
+        /*    (constant time on sorted storage)   */
+
+        iterator nth( size_type k )
+        {
+            return at_index(k);
+        }
+
+        const_iterator nth( size_type k ) const
+        {
+            return at_index(k);
+        }
+
+        size_type rank( const Key& key ) const
+        {
+            return _tree.lower_bound(key);
+        }
+
+        difference_type distance( const_iterator first, const_iterator last ) const
+        {
+            return last.base() - first.base();
+        }
+
+        /*              Observers               */
+
+        key_compare key_comp() const
+        {
+            return key_compare();
+        }
+
+        value_compare value_comp() const
+        {
+            return (value_compare(key_compare()));
+        }
+
+    private:
+        iterator at_index( size_type i )
+        {
+            return iterator(_tree.data() + i);
+        }
+
+        const_iterator at_index( size_type i ) const
+        {
+            return const_iterator(_tree.data() + i);
+        }
+
+        size_type index_of( const_iterator pos ) const
+        {
+            return pos.base() - _tree.data();
+        }
+    };
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator==( const ft::flat_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator!=( const ft::flat_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return !(lhs == rhs);
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator<( const ft::flat_map<Key,T,Compare,Alloc>& lhs,
+                const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator>( const ft::flat_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return rhs < lhs;
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator<=( const ft::flat_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return !(lhs > rhs);
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator>=( const ft::flat_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return !(lhs < rhs);
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    void swap( ft::flat_map<Key,T,Compare,Alloc>& lhs,
+           ft::flat_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return lhs.swap(rhs);
+    }
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+    /*
+    ** Sorted-vector counterpart of RBT, shared by flat_map and flat_set.
+    ** Elements are kept ordered by key in a single ft::vector, so lookups
+    ** are binary searches over contiguous memory and positions are plain
+    ** indices. Single inserts and erases shift the tail; insert_range
+    ** appends the whole batch and merges it in once.
+    */
+    template <class T, class f_object, class Compare, class Allocator = std::allocator<T> >
+    class flat_tree
+    {
+    public:
+        typedef ft::vector<T, Allocator>                container_type;
+        typedef typename f_object::key_type             key_type;
+        typedef std::size_t                             size_type;
+
+    private:
+        container_type  _data;
+        Compare         compare;
+        f_object        access;
+
+        // Orders whole elements by key, for the std algorithms.
+        struct value_less
+        {
+            const flat_tree* tree;
+
+            value_less(const flat_tree* t) : tree(t) {}
+
+            bool operator()(const T& lhs, const T& rhs) const
+            {
+                return tree->compare(tree->access(lhs), tree->access(rhs));
+            }
+        };
+
+        // Equality of neighbours in a sorted range: lhs <= rhs is known.
+        struct value_same
+        {
+            const flat_tree* tree;
+
+            value_same(const flat_tree* t) : tree(t) {}
+
+            bool operator()(const T& lhs, const T& rhs) const
+            {
+                return !tree->compare(tree->access(lhs), tree->access(rhs));
+            }
+        };
+
+    public:
+        flat_tree(const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+        : _data(alloc), compare(comp) {}
+
+        size_type size() const
+        {
+            return _data.size();
+        }
+
+        size_type capacity() const
+        {
+            return _data.capacity();
+        }
+
+        void reserve(size_type n)
+        {
+            _data.reserve(n);
+        }
+
+        T* data()
+        {
+            return _data.data();
+        }
+
+        const T* data() const
+        {
+            return _data.data();
+        }
+
+        T& value(size_type i)
+        {
+            return _data[i];
+        }
+
+        const T& value(size_type i) const
+        {
+            return _data[i];
+        }
+
+        /*              Lookup              */
+
+        // Index of the first element not less than key. The loop halves a
+        // window that always holds the answer and picks the half with a
+        // conditional move rather than a branch, so the mispredictions of
+        // a classic binary search go away.
+        size_type lower_bound(const key_type& key) const
+        {
+            size_type n = _data.size();
+            if (n == 0)
+                return 0;
+            const T* base = _data.data();
+            while (n > 1)
+            {
+                size_type half = n / 2;
+                base = compare(access(base[half]), key) ? base + half : base;
+                n -= half;
+            }
+            return (base - _data.data()) + compare(access(*base), key);
+        }
+
+        // Index of the first element greater than key.
+        size_type upper_bound(const key_type& key) const
+        {
+            size_type n = _data.size();
+            if (n == 0)
+                return 0;
+            const T* base = _data.data();
+            while (n > 1)
+            {
+                size_type half = n / 2;
+                base = !compare(key, access(base[half])) ? base + half : base;
+                n -= half;
+            }
+            return (base - _data.data()) + !compare(key, access(*base));
+        }
+
+        // Index of the element with key, size() when there is none.
+        size_type search(const key_type& key) const
+        {
+            size_type i = lower_bound(key);
+            return holds(i, key) ? i : _data.size();
+        }
+
+        // Whether the element at i has key; i comes from lower_bound.
+        bool holds(size_type i, const key_type& key) const
+        {
+            return i != _data.size() && !compare(key, access(_data[i]));
+        }
+
+        /*              Insertion               */
+
+        size_type insert_at(size_type i, const T& elem)
+        {
+            _data.insert(_data.begin() + i, elem);
+            return i;
+        }
+
+        ft::pair<size_type, bool> insert_unique(const T& elem)
+        {
+            size_type i = lower_bound(access(elem));
+            if (holds(i, access(elem)))
+                return ft::make_pair(i, false);
+            return ft::make_pair(insert_at(i, elem), true);
+        }
+
+        // Inserts at hint when that keeps the order, searches otherwise.
+        size_type insert_hint(size_type hint, const T& elem)
+        {
+            if (fits(hint, access(elem)))
+                return insert_at(hint, elem);
+            return insert_unique(elem).first;
+        }
+
+#if __cplusplus >= 201103L
+        size_type insert_at(size_type i, T&& elem)
+        {
+            _data.insert(_data.begin() + i, std::move(elem));
+            return i;
+        }
+
+        template <class... Args>
+        size_type emplace_at(size_type i, Args&&... args)
+        {
+            _data.emplace(_data.begin() + i, std::forward<Args>(args)...);
+            return i;
+        }
+
+        ft::pair<size_type, bool> insert_unique(T&& elem)
+        {
+            size_type i = lower_bound(access(elem));
+            if (holds(i, access(elem)))
+                return ft::make_pair(i, false);
+            return ft::make_pair(insert_at(i, std::move(elem)), true);
+        }
+
+        template <class... Args>
+        ft::pair<size_type, bool> emplace_unique(Args&&... args)
+        {
+            T tmp(std::forward<Args>(args)...);
+            return insert_unique(std::move(tmp));
+        }
+
+        template <class... Args>
+        size_type emplace_hint_unique(size_type hint, Args&&... args)
+        {
+            T tmp(std::forward<Args>(args)...);
+            if (fits(hint, access(tmp)))
+                return insert_at(hint, std::move(tmp));
+            return insert_unique(std::move(tmp)).first;
+        }
+#endif
+
+        // Appends the batch, sorts it on its own and merges it into the
+        // existing elements in one pass, instead of shifting the tail once
+        // per element. Elements already present win over new ones with an
+        // equivalent key, and so does the first of several new ones. Sorted
+        // batches skip the sort, and batches past the current maximum skip
+        // the merge.
+        template <class InputIt>
+        void insert_range(InputIt first, InputIt last)
+        {
+            size_type old_size = _data.size();
+            try
+            {
+                for (; first != last; ++first)
+                    _data.push_back(*first);
+                if (!is_sorted(old_size))
+                    std::stable_sort(_data.data() + old_size, _data.data() + _data.size(), value_less(this));
+            }
+            catch (...)
+            {
+                _data.erase(_data.begin() + old_size, _data.end());
+                throw;
+            }
+            if (_data.size() == old_size)
+                return;
+            T* base = _data.data();
+            T* end = base + _data.size();
+            T* from = base + old_size;
+            if (old_size != 0 && !compare(access(base[old_size - 1]), access(base[old_size])))
+            {
+                std::inplace_merge(base, base + old_size, end, value_less(this));
+                from = base;
+            }
+            T* unique_end = std::unique(from, end, value_same(this));
+            _data.erase(_data.begin() + (unique_end - base), _data.end());
+        }
+
+        /*              Removal             */
+
+        void erase_at(size_type i)
+        {
+            _data.erase(_data.begin() + i);
+        }
+
+        void erase_range(size_type first, size_type last)
+        {
+            _data.erase(_data.begin() + first, _data.begin() + last);
+        }
+
+        void delete_all()
+        {
+            _data.clear();
+        }
+
+        void swap(flat_tree& other)
+        {
+            _data.swap(other._data);
+            std::swap(compare, other.compare);
+        }
+
+    private:
+        // Whether a key can go at index i without breaking the order.
+        bool fits(size_type i, const key_type& key) const
+        {
+            if (i > _data.size())
+                return false;
+            if (i != 0 && !compare(access(_data[i - 1]), key))
+                return false;
+            return i == _data.size() || compare(key, access(_data[i]));
+        }
+
+        // Whether the elements from index first on are sorted.
+        bool is_sorted(size_type first) const
+        {
+            for (size_type i = first + 1; i < _data.size(); i++)
+                if (compare(access(_data[i]), access(_data[i - 1])))
+                    return false;
+            return true;
+        }
+    };
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+
+/*
+** Growth policies for vector. grow() returns the capacity to move to when
+** a buffer of capacity elements of elem_size bytes needs room for at least
+** required elements; the result is never below required.
+*/
+
+namespace ft
+{
+    // Multiplies the capacity by Num / Den.
+    template <std::size_t Num, std::size_t Den>
+    struct geometric_growth
+    {
+        static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t elem_size)
+        {
+            (void)elem_size;
+            std::size_t c = capacity * Num / Den;
+            if (c <= capacity)
+                c = capacity + 1;
+            return c < required ? required : c;
+        }
+    };
+
+    typedef geometric_growth<2, 1> double_growth;
+    typedef geometric_growth<3, 2> golden_growth;
+
+    // Doubles, then rounds buffers of a page or more up to whole pages, so
+    // the tail of the last page the allocator hands out is not wasted.
+    template <std::size_t PageSize = 4096>
+    struct page_growth
+    {
+        static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t elem_size)
+        {
+            std::size_t c = double_growth::grow(capacity, required, elem_size);
+            std::size_t bytes = c * elem_size;
+            if (bytes < PageSize)
+                return c;
+            bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+            return bytes / elem_size;
+        }
+    };
+
+    // Doubles, then rounds the byte size up to the size classes of common
+    // malloc implementations (jemalloc, tcmalloc): four classes between
+    // consecutive powers of two. The slack the allocator would add anyway
+    // becomes usable capacity.
+    struct size_class_growth
+    {
+        static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t elem_size)
+        {
+            std::size_t c = double_growth::grow(capacity, required, elem_size);
+            std::size_t bytes = c * elem_size;
+            if (bytes <= 16)
+                return 16 / elem_size > c ? 16 / elem_size : c;
+            std::size_t base = 16;
+            while (base * 2 < bytes)
+                base *= 2;
+            std::size_t step = base / 4;
+            bytes = (bytes + step - 1) / step * step;
+            return bytes / elem_size;
+        }
+    };
+
+    // What a container of capacity elements grows to when at least
+    // required must fit, without passing max_size unless required does.
+    template <class Growth>
+    std::size_t recommend_capacity(std::size_t capacity, std::size_t required,
+        std::size_t elem_size, std::size_t max_size)
+    {
+        std::size_t cap = Growth::grow(capacity, required, elem_size);
+        if (cap > max_size && required <= max_size)
+            return max_size;
+        return cap;
+    }
+}
@@ -0,0 +1,866 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include "utility.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#if __cplusplus >= 201103L
+# include <functional>
+#endif
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
+
+namespace ft
+{
+    /*              Hashing             */
+
+#if __cplusplus >= 201103L
+    template <class T>
+    struct hash : std::hash<T> {};
+#else
+    template <class T>
+    struct hash;
+
+    template <class T>
+    struct hash<T*>
+    {
+        std::size_t operator()(T* p) const
+        {
+            return reinterpret_cast<std::size_t>(p);
+        }
+    };
+
+# define FT_INTEGRAL_HASH(type)                                 \
+    template <> struct hash<type>                               \
+    {                                                           \
+        std::size_t operator()(type x) const                    \
+        {                                                       \
+            return static_cast<std::size_t>(x);                 \
+        }                                                       \
+    };
+
+    FT_INTEGRAL_HASH(bool)
+    FT_INTEGRAL_HASH(char)
+    FT_INTEGRAL_HASH(signed char)
+    FT_INTEGRAL_HASH(unsigned char)
+    FT_INTEGRAL_HASH(wchar_t)
+    FT_INTEGRAL_HASH(short)
+    FT_INTEGRAL_HASH(unsigned short)
+    FT_INTEGRAL_HASH(int)
+    FT_INTEGRAL_HASH(unsigned int)
+    FT_INTEGRAL_HASH(long)
+    FT_INTEGRAL_HASH(unsigned long)
+    FT_INTEGRAL_HASH(long long)
+    FT_INTEGRAL_HASH(unsigned long long)
+# undef FT_INTEGRAL_HASH
+
+    // FNV-1a.
+    template <>
+    struct hash<std::string>
+    {
+        std::size_t operator()(const std::string& s) const
+        {
+            std::size_t h = static_cast<std::size_t>(2166136261u);
+            for (std::size_t i = 0; i < s.size(); i++)
+            {
+                h ^= static_cast<unsigned char>(s[i]);
+                h *= static_cast<std::size_t>(16777619u);
+            }
+            return h;
+        }
+    };
+#endif
+
+    /*              Control bytes               */
+
+    /*
+    ** Every slot of a hash_table has a control byte: the low 7 bits of
+    ** the hash when it is full, or one of the negative markers below.
+    ** Probing compares a whole group of 16 control bytes against the
+    ** hash in one go (a single SSE2 compare when available) and only
+    ** looks at the slots whose byte matched.
+    */
+    enum
+    {
+        ctrl_empty = -128,
+        ctrl_deleted = -2,
+        ctrl_sentinel = -1
+    };
+
+    typedef signed char ctrl_t;
+
+    inline int lowest_bit(unsigned mask)
+    {
+#if defined(__GNUC__)
+        return __builtin_ctz(mask);
+#else
+        int n = 0;
+        while (!(mask & 1))
+        {
+            mask >>= 1;
+            n++;
+        }
+        return n;
+#endif
+    }
+
+    inline int highest_bit(unsigned mask)
+    {
+#if defined(__GNUC__)
+        return 31 - __builtin_clz(mask);
+#else
+        int n = 0;
+        while (mask >>= 1)
+            n++;
+        return n;
+#endif
+    }
+
+    // 16 control bytes; each match returns one bit per matching byte.
+    struct hash_group
+    {
+        enum { width = 16 };
+
+#ifdef __SSE2__
+        __m128i ctrl;
+
+        explicit hash_group(const ctrl_t* p)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+        unsigned match(ctrl_t h) const
+        {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h), ctrl));
+        }
+
+        unsigned match_empty() const
+        {
+            return match(static_cast<ctrl_t>(ctrl_empty));
+        }
+
+        // Empty and deleted are the only bytes below the sentinel.
+        unsigned match_empty_or_deleted() const
+        {
+            return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(ctrl_sentinel)), ctrl));
+        }
+#else
+        const ctrl_t* ctrl;
+
+        explicit hash_group(const ctrl_t* p) : ctrl(p) {}
+
+        unsigned match(ctrl_t h) const
+        {
+            unsigned mask = 0;
+            for (int i = 0; i < width; i++)
+                if (ctrl[i] == h)
+                    mask |= 1u << i;
+            return mask;
+        }
+
+        unsigned match_empty() const
+        {
+            return match(static_cast<ctrl_t>(ctrl_empty));
+        }
+
+        unsigned match_empty_or_deleted() const
+        {
+            unsigned mask = 0;
+            for (int i = 0; i < width; i++)
+                if (ctrl[i] < ctrl_sentinel)
+                    mask |= 1u << i;
+            return mask;
+        }
+#endif
+    };
+
+    // Control bytes of a table without slots, so that lookups in an empty
+    // container need neither an allocation nor a special case.
+    template <class Dummy>
+    struct hash_empty_group
+    {
+        static const ctrl_t ctrl[hash_group::width];
+    };
+
+    template <class Dummy>
+    const ctrl_t hash_empty_group<Dummy>::ctrl[hash_group::width] = {
+        ctrl_sentinel, ctrl_empty, ctrl_empty, ctrl_empty,
+        ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+        ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+        ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty
+    };
+
+    /*              Iterators               */
+
+    template <typename T>
+    class hash_iterator : public ft::iterator <ft::forward_iterator_tag, T>
+    {
+        ctrl_t* ctrl;
+        T*      slot;
+
+    public:
+        typedef typename ft::iterator<ft::forward_iterator_tag, T>::iterator_category   iterator_category;
+        typedef typename ft::iterator<ft::forward_iterator_tag, T>::value_type          value_type;
+        typedef typename ft::iterator<ft::forward_iterator_tag, T>::difference_type     difference_type;
+        typedef typename ft::iterator<ft::forward_iterator_tag, T>::pointer             pointer;
+        typedef typename ft::iterator<ft::forward_iterator_tag, T>::reference           reference;
+
+        hash_iterator() : ctrl(NULL), slot(NULL) {}
+
+        hash_iterator(ctrl_t* c, T* s) : ctrl(c), slot(s) {}
+
+        ctrl_t* base() const
+        {
+            return ctrl;
+        }
+
+        T* slot_ptr() const
+        {
+            return slot;
+        }
+
+        T& operator* () const
+        {
+            return *slot;
+        }
+
+        T* operator-> () const
+        {
+            return slot;
+        }
+
+        // Stops on the next full slot or on the sentinel after the last.
+        hash_iterator &operator++()
+        {
+            do
+            {
+                ++ctrl;
+                ++slot;
+            }
+            while (*ctrl < ctrl_sentinel);
+            return *this;
+        }
+
+        hash_iterator operator++(int)
+        {
+            hash_iterator temp(*this);
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const hash_iterator &rhs) const
+        {
+            return ctrl == rhs.ctrl;
+        }
+
+        bool operator!=(const hash_iterator &rhs) const
+        {
+            return ctrl != rhs.ctrl;
+        }
+    };
+
+    template <typename T>
+    class hash_const_iterator : public ft::iterator <ft::forward_iterator_tag, const T>
+    {
+        hash_iterator<T> it;
+
+    public:
+        typedef typename ft::iterator<ft::forward_iterator_tag, const T>::iterator_category iterator_category;
+        typedef typename ft::iterator<ft::forward_iterator_tag, const T>::value_type        value_type;
+        typedef typename ft::iterator<ft::forward_iterator_tag, const T>::difference_type   difference_type;
+        typedef typename ft::iterator<ft::forward_iterator_tag, const T>::pointer           pointer;
+        typedef typename ft::iterator<ft::forward_iterator_tag, const T>::reference         reference;
+
+        hash_const_iterator() {}
+
+        hash_const_iterator(const hash_iterator<T>& other) : it(other) {}
+
+        ctrl_t* base() const
+        {
+            return it.base();
+        }
+
+        T* slot_ptr() const
+        {
+            return it.slot_ptr();
+        }
+
+        const T& operator* () const
+        {
+            return *it;
+        }
+
+        const T* operator-> () const
+        {
+            return it.operator->();
+        }
+
+        hash_const_iterator &operator++()
+        {
+            ++it;
+            return *this;
+        }
+
+        hash_const_iterator operator++(int)
+        {
+            hash_const_iterator temp(*this);
+            ++it;
+            return temp;
+        }
+
+        bool operator==(const hash_const_iterator &rhs) const
+        {
+            return base() == rhs.base();
+        }
+
+        bool operator!=(const hash_const_iterator &rhs) const
+        {
+            return base() != rhs.base();
+        }
+    };
+
+    template <typename T>
+    bool operator==(const hash_iterator<T>& lhs, const hash_const_iterator<T>& rhs)
+    {
+        return lhs.base() == rhs.base();
+    }
+
+    template <typename T>
+    bool operator!=(const hash_iterator<T>& lhs, const hash_const_iterator<T>& rhs)
+    {
+        return lhs.base() != rhs.base();
+    }
+
+    /*
+    ** Open-addressing hash table shared by unordered_map and unordered_set.
+    ** Elements live directly in one slot array whose size is a power of
+    ** two minus one, next to an array of control bytes (see above) that
+    ** ends with a sentinel followed by a copy of its first 15 bytes, so
+    ** a group can be loaded at any slot without wrapping. Probing visits
+    ** groups in triangular steps. Erased slots become tombstones unless
+    ** no probe could have run past them; rehashing drops the tombstones.
+    ** Inserting may rehash and invalidate iterators, erasing never moves
+    ** other elements.
+    */
+    template <class T, class f_object, class Hash, class KeyEqual, class Allocator = std::allocator<T> >
+    class hash_table
+    {
+    public:
+        typedef typename f_object::key_type                         key_type;
+        typedef hash_iterator<T>                                    iterator;
+        typedef hash_const_iterator<T>                              const_iterator;
+
+    private:
+        typedef typename Allocator::template rebind<T>::other       slot_allocator;
+        typedef typename Allocator::template rebind<ctrl_t>::other  ctrl_allocator;
+
+        enum { width = hash_group::width, min_capacity = width - 1 };
+
+        ctrl_t*         _ctrl;
+        T*              _slots;
+        std::size_t     _capacity;
+        std::size_t     _size;
+        std::size_t     _growth_left;
+        float           _max_load;
+        Hash            hasher;
+        KeyEqual        equal;
+        f_object        access;
+        slot_allocator  slot_alloc;
+        ctrl_allocator  ctrl_alloc;
+
+    public:
+        hash_table(std::size_t n = 0, const Hash& hash = Hash(), const KeyEqual& eq = KeyEqual())
+        : _ctrl(empty_ctrl()), _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+          _max_load(0.875f), hasher(hash), equal(eq)
+        {
+            if (n)
+                reserve(n);
+        }
+
+        hash_table(const hash_table& other)
+        : _ctrl(empty_ctrl()), _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+          _max_load(other._max_load), hasher(other.hasher), equal(other.equal)
+        {
+            copy_from(other);
+        }
+
+        hash_table& operator=(const hash_table& other)
+        {
+            if (this == &other)
+                return *this;
+            delete_all();
+            _max_load = other._max_load;
+            hasher = other.hasher;
+            equal = other.equal;
+            copy_from(other);
+            return *this;
+        }
+
+#if __cplusplus >= 201103L
+        hash_table(hash_table&& other)
+        : _ctrl(empty_ctrl()), _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+          _max_load(other._max_load), hasher(other.hasher), equal(other.equal)
+        {
+            swap(other);
+        }
+
+        hash_table& operator=(hash_table&& other)
+        {
+            if (this == &other)
+                return *this;
+            delete_all();
+            swap(other);
+            return *this;
+        }
+#endif
+
+        ~hash_table()
+        {
+            delete_all();
+        }
+
+        std::size_t size() const
+        {
+            return _size;
+        }
+
+        std::size_t capacity() const
+        {
+            return _capacity;
+        }
+
+        iterator begin() const
+        {
+            iterator it(_ctrl, _slots);
+            if (*_ctrl < ctrl_sentinel)
+                ++it;
+            return it;
+        }
+
+        iterator end() const
+        {
+            return iterator(_ctrl + _capacity, _slots + _capacity);
+        }
+
+        Hash hash_function() const
+        {
+            return hasher;
+        }
+
+        KeyEqual key_eq() const
+        {
+            return equal;
+        }
+
+        /*              Lookup              */
+
+        iterator search(const key_type& key) const
+        {
+            std::size_t i = find_index(key, hash_of(key));
+            return i == npos() ? end() : at(i);
+        }
+
+        // Finds key; otherwise returns end() and the hash to insert it with.
+        iterator find_insert_position(const key_type& key, std::size_t& hash) const
+        {
+            hash = hash_of(key);
+            std::size_t i = find_index(key, hash);
+            return i == npos() ? end() : at(i);
+        }
+
+        /*              Insertion               */
+
+        ft::pair<iterator, bool> insert_unique(const T& elem)
+        {
+            std::size_t hash;
+            iterator it = find_insert_position(access(elem), hash);
+            if (it != end())
+                return ft::make_pair(it, false);
+            return ft::make_pair(insert_at(hash, elem), true);
+        }
+
+        iterator insert_at(std::size_t hash, const T& elem)
+        {
+            std::size_t i = prepare_insert(hash);
+            ::new (static_cast<void*>(_slots + i)) T(elem);
+            return commit_insert(i, hash);
+        }
+
+#if __cplusplus >= 201103L
+        iterator insert_at(std::size_t hash, T&& elem)
+        {
+            std::size_t i = prepare_insert(hash);
+            ::new (static_cast<void*>(_slots + i)) T(std::move(elem));
+            return commit_insert(i, hash);
+        }
+
+        ft::pair<iterator, bool> insert_unique(T&& elem)
+        {
+            std::size_t hash;
+            iterator it = find_insert_position(access(elem), hash);
+            if (it != end())
+                return ft::make_pair(it, false);
+            return ft::make_pair(insert_at(hash, std::move(elem)), true);
+        }
+
+        template <class... Args>
+        ft::pair<iterator, bool> emplace_unique(Args&&... args)
+        {
+            T tmp(std::forward<Args>(args)...);
+            return insert_unique(std::move(tmp));
+        }
+#endif
+
+        template <class InputIt>
+        void insert_range(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                insert_unique(*first);
+        }
+
+        /*              Removal             */
+
+        // A slot can go straight back to empty when the groups around it
+        // were never full, since no probe sequence ever went past it.
+        void erase(iterator pos)
+        {
+            std::size_t i = pos.base() - _ctrl;
+            _slots[i].~T();
+            _size--;
+            std::size_t before = (i - width) & _capacity;
+            unsigned empty_after = hash_group(_ctrl + i).match_empty();
+            unsigned empty_before = hash_group(_ctrl + before).match_empty();
+            if (empty_after && empty_before
+                && lowest_bit(empty_after) + (width - 1 - highest_bit(empty_before)) < width)
+            {
+                set_ctrl(i, static_cast<ctrl_t>(ctrl_empty));
+                _growth_left++;
+            }
+            else
+                set_ctrl(i, static_cast<ctrl_t>(ctrl_deleted));
+        }
+
+        void erase_range(iterator first, iterator last)
+        {
+            while (first != last)
+                erase(first++);
+        }
+
+        std::size_t erase_key(const key_type& key)
+        {
+            iterator it = search(key);
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+        // Destroys the elements but keeps the slots for reuse.
+        void clear()
+        {
+            if (_capacity == 0)
+                return;
+            destroy_slots();
+            reset_ctrl();
+            _size = 0;
+            _growth_left = growth_for(_capacity);
+        }
+
+        void delete_all()
+        {
+            if (_capacity == 0)
+                return;
+            destroy_slots();
+            ctrl_alloc.deallocate(_ctrl, _capacity + width);
+            slot_alloc.deallocate(_slots, _capacity);
+            _ctrl = empty_ctrl();
+            _slots = NULL;
+            _capacity = 0;
+            _size = 0;
+            _growth_left = 0;
+        }
+
+        void swap(hash_table& other)
+        {
+            std::swap(_ctrl, other._ctrl);
+            std::swap(_slots, other._slots);
+            std::swap(_capacity, other._capacity);
+            std::swap(_size, other._size);
+            std::swap(_growth_left, other._growth_left);
+            std::swap(_max_load, other._max_load);
+            std::swap(hasher, other.hasher);
+            std::swap(equal, other.equal);
+            std::swap(slot_alloc, other.slot_alloc);
+            std::swap(ctrl_alloc, other.ctrl_alloc);
+        }
+
+        /*              Sizing              */
+
+        float max_load_factor() const
+        {
+            return _max_load;
+        }
+
+        // Takes effect at the next rehash; at least one slot always stays
+        // empty so that probes terminate. Tombstones take room like
+        // elements until then.
+        void max_load_factor(float ml)
+        {
+            if (ml > 0.0f && ml <= 1.0f)
+                _max_load = ml;
+            std::size_t growth = growth_for(_capacity);
+            std::size_t used = _size + count_deleted();
+            _growth_left = growth > used ? growth - used : 0;
+        }
+
+        // Rebuilds the table with room for at least n slots, and never
+        // below what the current elements need.
+        void rehash(std::size_t n)
+        {
+            std::size_t need = static_cast<std::size_t>(_size / _max_load) + 1;
+            if (n < need)
+                n = need;
+            if (n == 0 && _size == 0)
+            {
+                delete_all();
+                return;
+            }
+            std::size_t cap = normalize(n);
+            if (cap != _capacity)
+                resize(cap);
+        }
+
+        void reserve(std::size_t n)
+        {
+            if (n > _size + _growth_left)
+                rehash(static_cast<std::size_t>(n / _max_load) + 1);
+        }
+
+    private:
+        static std::size_t npos()
+        {
+            return static_cast<std::size_t>(-1);
+        }
+
+        static ctrl_t* empty_ctrl()
+        {
+            return const_cast<ctrl_t*>(hash_empty_group<void>::ctrl);
+        }
+
+        iterator at(std::size_t i) const
+        {
+            return iterator(_ctrl + i, _slots + i);
+        }
+
+        // Spreads weak hashes (identity hashes of integers) over all bits
+        // before they are split into a probe start and a 7-bit tag.
+        std::size_t hash_of(const key_type& key) const
+        {
+            std::size_t h = hasher(key);
+            if (sizeof(std::size_t) >= 8)
+            {
+                h *= static_cast<std::size_t>(0x9E3779B97F4A7C15ULL);
+                h ^= h >> 29;
+            }
+            else
+            {
+                h *= static_cast<std::size_t>(0x9E3779B9u);
+                h ^= h >> 15;
+            }
+            return h;
+        }
+
+        static ctrl_t tag_of(std::size_t hash)
+        {
+            return static_cast<ctrl_t>(hash & 0x7F);
+        }
+
+        std::size_t probe_start(std::size_t hash) const
+        {
+            return (hash >> 7) & _capacity;
+        }
+
+        std::size_t find_index(const key_type& key, std::size_t hash) const
+        {
+            std::size_t pos = probe_start(hash);
+            std::size_t step = 0;
+            ctrl_t tag = tag_of(hash);
+            while (true)
+            {
+                hash_group g(_ctrl + pos);
+                for (unsigned m = g.match(tag); m; m &= m - 1)
+                {
+                    std::size_t i = (pos + lowest_bit(m)) & _capacity;
+                    if (equal(access(_slots[i]), key))
+                        return i;
+                }
+                if (g.match_empty())
+                    return npos();
+                step += width;
+                pos = (pos + step) & _capacity;
+            }
+        }
+
+        std::size_t find_first_free(std::size_t hash) const
+        {
+            std::size_t pos = probe_start(hash);
+            std::size_t step = 0;
+            while (true)
+            {
+                unsigned m = hash_group(_ctrl + pos).match_empty_or_deleted();
+                if (m)
+                    return (pos + lowest_bit(m)) & _capacity;
+                step += width;
+                pos = (pos + step) & _capacity;
+            }
+        }
+
+        // Returns the slot for a new element with hash, growing first when
+        // it would take an empty slot and the load limit is reached.
+        std::size_t prepare_insert(std::size_t hash)
+        {
+            std::size_t i = find_first_free(hash);
+            if (_growth_left == 0 && _ctrl[i] != ctrl_deleted)
+            {
+                grow();
+                i = find_first_free(hash);
+            }
+            return i;
+        }
+
+        iterator commit_insert(std::size_t i, std::size_t hash)
+        {
+            if (_ctrl[i] == ctrl_empty)
+                _growth_left--;
+            set_ctrl(i, tag_of(hash));
+            _size++;
+            return at(i);
+        }
+
+        // Writes a control byte and its copy past the sentinel.
+        void set_ctrl(std::size_t i, ctrl_t c)
+        {
+            _ctrl[i] = c;
+            if (i < width - 1)
+                _ctrl[_capacity + 1 + i] = c;
+        }
+
+        void reset_ctrl()
+        {
+            std::memset(_ctrl, ctrl_empty, _capacity + width);
+            _ctrl[_capacity] = ctrl_sentinel;
+        }
+
+        std::size_t count_deleted() const
+        {
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < _capacity; i++)
+                if (_ctrl[i] == ctrl_deleted)
+                    n++;
+            return n;
+        }
+
+        std::size_t growth_for(std::size_t cap) const
+        {
+            if (cap == 0)
+                return 0;
+            std::size_t g = static_cast<std::size_t>(cap * _max_load);
+            return g < cap ? g : cap - 1;
+        }
+
+        // Smallest 2^k - 1 capacity holding n slots.
+        static std::size_t normalize(std::size_t n)
+        {
+            std::size_t cap = min_capacity;
+            while (cap < n)
+                cap = cap * 2 + 1;
+            return cap;
+        }
+
+        // Doubles, or only clears tombstones when they are what fills
+        // the table.
+        void grow()
+        {
+            if (_capacity == 0)
+                resize(min_capacity);
+            else if (_size <= growth_for(_capacity) / 2)
+                resize(_capacity);
+            else
+                resize(_capacity * 2 + 1);
+        }
+
+        void resize(std::size_t new_cap)
+        {
+            ctrl_t* old_ctrl = _ctrl;
+            T* old_slots = _slots;
+            std::size_t old_cap = _capacity;
+            _slots = slot_alloc.allocate(new_cap);
+            try
+            {
+                _ctrl = ctrl_alloc.allocate(new_cap + width);
+            }
+            catch (...)
+            {
+                slot_alloc.deallocate(_slots, new_cap);
+                _slots = old_slots;
+                throw;
+            }
+            _capacity = new_cap;
+            reset_ctrl();
+            for (std::size_t i = 0; i < old_cap; i++)
+            {
+                if (old_ctrl[i] < 0)
+                    continue;
+                std::size_t hash = hash_of(access(old_slots[i]));
+                std::size_t j = find_first_free(hash);
+                set_ctrl(j, tag_of(hash));
+                relocate(_slots + j, old_slots + i);
+            }
+            std::size_t growth = growth_for(_capacity);
+            _growth_left = growth > _size ? growth - _size : 0;
+            if (old_cap)
+            {
+                ctrl_alloc.deallocate(old_ctrl, old_cap + width);
+                slot_alloc.deallocate(old_slots, old_cap);
+            }
+        }
+
+        static void relocate(T* dst, T* src)
+        {
+            if (is_trivially_relocatable<T>::value)
+            {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(T));
+                return;
+            }
+#if __cplusplus >= 201103L
+            ::new (static_cast<void*>(dst)) T(std::move(*src));
+#else
+            ::new (static_cast<void*>(dst)) T(*src);
+#endif
+            src->~T();
+        }
+
+        void destroy_slots()
+        {
+            for (std::size_t i = 0; i < _capacity; i++)
+                if (_ctrl[i] >= 0)
+                    _slots[i].~T();
+        }
+
+        void copy_from(const hash_table& other)
+        {
+            if (other._size == 0)
+                return;
+            resize(normalize(static_cast<std::size_t>(other._size / _max_load) + 1));
+            for (iterator it = other.begin(); it != other.end(); ++it)
+            {
+                std::size_t hash = hash_of(access(*it));
+                insert_at(hash, *it);
+            }
+        }
+    };
+}
@@ -0,0 +1,406 @@
+#pragma once
+#include <iostream>
+#include "reverse_iterator.hpp"
+#include "type_traits.hpp"
+#include "bidirectional_iterator.hpp"
+#include "algorithm.hpp"
+#include <new>
+#include "RBT.hpp"
+#include "pool_allocator.hpp"
+#include "tree_policy.hpp"
+
+namespace ft
+{
+    /*
+    ** Map keyed by half-open intervals [first, second), ordered by start
+    ** and then by end. Every node keeps the largest end point of its
+    ** subtree, so finding an interval overlapping a query is O(log n) and
+    ** listing all k of them is O(k log n). Compare must be stateless.
+    */
+    template<
+        class Key,
+        class T,
+        class Compare = std::less<Key>,
+        class Allocator = ft::pool_allocator<ft::pair<const ft::pair<Key, Key>, T> >
+    > class interval_map
+    {
+    public:
+
+        typedef ft::pair<Key, Key>                              interval_type;
+        typedef interval_type                                   key_type;
+        typedef T                                               mapped_type;
+        typedef ft::pair<const interval_type, T>                value_type;
+        typedef std::size_t                                     size_type;
+        typedef std::ptrdiff_t                                  difference_type;
+        typedef Compare                                         endpoint_compare;
+        typedef Allocator                                       allocator_type;
+        typedef value_type&                                     reference;
+        typedef const value_type&                               const_reference;
+        typedef typename Allocator::pointer                     pointer;
+        typedef typename Allocator::const_pointer               const_pointer;
+        typedef ft::bidirectional_iterator<value_type>          iterator;
+        typedef ft::bidirectional_const_iterator<value_type>    const_iterator;
+        typedef ft::reverse_iterator<iterator>                  reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+        class key_compare
+        {
+            public:
+                key_compare(Compare c = Compare()) : _comp(c) {}
+
+                bool operator()(const interval_type &lhs, const interval_type &rhs) const
+                {
+                    if (_comp(lhs.first, rhs.first))
+                        return true;
+                    if (_comp(rhs.first, lhs.first))
+                        return false;
+                    return _comp(lhs.second, rhs.second);
+                }
+
+            private:
+                Compare _comp;
+        };
+
+    private:
+
+        template <typename Type>
+        struct SelectFirst
+        {
+            typedef typename Type::first_type key_type;
+            key_type &operator()(Type &val)
+            {
+                return val.first;
+            }
+            const key_type &operator()(const Type &val) const
+            {
+                return val.first;
+            }
+        };
+
+        // The aggregate policy is static, so MaxEnd orders end points with
+        // a default-constructed Compare: a comparator with state would
+        // disagree with the tree order.
+#if __cplusplus >= 201103L
+        static_assert(ft::is_empty<Compare>::value, "interval_map needs a stateless Compare");
+#else
+        typedef char compare_must_be_stateless[ft::is_empty<Compare>::value ? 1 : -1];
+#endif
+
+        struct MaxEnd
+        {
+            typedef Key value_type;
+
+            static Key lift(const ft::pair<const interval_type, T>& val)
+            {
+                return val.first.second;
+            }
+
+            static Key combine(const Key& a, const Key& b)
+            {
+                return Compare()(a, b) ? b : a;
+            }
+        };
+
+        typedef  rb_node_base*                              NodePtr;
+        typedef  ft::aggregate_augment<MaxEnd>              augment;
+
+        RBT<value_type, SelectFirst<value_type>, key_compare, Allocator, augment>   _tree;
+        allocator_type                                                              _alloc;
+        Compare                                                                     _comp;
+
+    public:
+        /*              Constructors            */
+
+        interval_map() : _tree(key_compare()) {}
+
+        explicit interval_map( const Compare& comp,
+            const Allocator& alloc = Allocator()) : _tree(key_compare(comp)), _alloc(alloc), _comp(comp) {}
+
+        template< class InputIt >
+        interval_map( InputIt first, InputIt last, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator(), typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+            : _tree(key_compare(comp)), _alloc(alloc), _comp(comp)
+        {
+            _tree.insert_range(first, last);
+        }
+
+        interval_map( const interval_map& other )
+        : _tree(other._tree), _alloc(other._alloc), _comp(other._comp) {}
+
+        /*             Destructor          */
+
+        ~interval_map()
+        {
+            _tree.delete_all();
+        }
+
+        interval_map& operator=( const interval_map& other )
+        {
+            _tree = other._tree;
+            _comp = other._comp;
+            return *this;
+        }
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        /*             Element access           */
+
+        T& at( const interval_type& key )
+        {
+            NodePtr ret = _tree.search(key);
+            if (ret == _tree.getEnd())
+                throw  std::out_of_range("interval_map::at");
+            return _tree.value(ret).second;
+        }
+
+        const T& at( const interval_type& key ) const
+        {
+            NodePtr ret = _tree.search(key);
+            if (ret == _tree.getEnd())
+                throw  std::out_of_range("interval_map::at");
+            return _tree.value(ret).second;
+        }
+
+        T& operator[]( const interval_type& key )
+        {
+            return insert(value_type(key, T())).first->second;
+        }
+
+        /*              Iterators               */
+
+        iterator begin()
+        {
+            return iterator(_tree.size() == 0 ? _tree.getEnd() : _tree.minimum());
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(_tree.size() == 0 ? _tree.getEnd() : _tree.minimum());
+        }
+
+        iterator end()
+        {
+            return iterator(_tree.getEnd());
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(_tree.getEnd());
+        }
+
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        /*             Capacity                */
+
+        bool empty() const
+        {
+            return _tree.size() == 0;
+        }
+
+        size_type size() const
+        {
+            return _tree.size();
+        }
+
+        size_type max_size() const
+        {
+            return _alloc.max_size();
+        }
+
+        /*              Modifiers           */
+
+        void clear()
+        {
+            _tree.delete_all();
+        }
+
+        ft::pair<iterator, bool> insert( const value_type& value )
+        {
+            ft::pair<NodePtr, bool> ret = _tree.insert_unique(value);
+            return ft::make_pair(iterator(ret.first), ret.second);
+        }
+
+        iterator insert( iterator pos, const value_type& value )
+        {
+            return iterator(_tree.insert(pos, value));
+        }
+
+        template< class InputIt >
+        void insert( InputIt first, InputIt last, typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+        {
+            _tree.insert_range(first, last);
+        }
+
+        void erase( iterator pos )
+        {
+            _tree.erase_node(pos.base());
+        }
+
+        void erase( iterator first, iterator last )
+        {
+            _tree.erase_range(first.base(), last.base());
+        }
+
+        size_type erase( const interval_type& key )
+        {
+            NodePtr tmp = _tree.search(key);
+            if (tmp == _tree.getEnd())
+                return 0;
+            _tree.erase_node(tmp);
+            return 1;
+        }
+
+        void swap( interval_map& other )
+        {
+            this->_tree.swap(other._tree);
+            Compare tmp = this->_comp;
+            this->_comp = other._comp;
+            other._comp = tmp;
+        }
+
+        /*              Lookup              */
+
+        size_type count( const interval_type& key ) const
+        {
+            return (_tree.search(key) == _tree.getEnd() ? 0 : 1);
+        }
+
+        iterator find( const interval_type& key )
+        {
+            return iterator(_tree.search(key));
+        }
+
+        const_iterator find( const interval_type& key ) const
+        {
+            return const_iterator(_tree.search(key));
+        }
+
+        iterator lower_bound( const interval_type& key )
+        {
+            return iterator(_tree.lower_bound(key));
+        }
+
+        const_iterator lower_bound( const interval_type& key ) const
+        {
+            return const_iterator(_tree.lower_bound(key));
+        }
+
+        iterator upper_bound( const interval_type& key )
+        {
+            return iterator(_tree.upper_bound(key));
+        }
+
+        const_iterator upper_bound( const interval_type& key ) const
+        {
+            return const_iterator(_tree.upper_bound(key));
+        }
+
+        /*              Interval queries            */
+
+        // Some interval overlapping [lo, hi), or end().
+        iterator find_overlap( const Key& lo, const Key& hi )
+        {
+            return iterator(overlap_helper(lo, hi));
+        }
+
+        const_iterator find_overlap( const Key& lo, const Key& hi ) const
+        {
+            return const_iterator(overlap_helper(lo, hi));
+        }
+
+        // Writes iterators to every interval overlapping [lo, hi) to out,
+        // in order.
+        template <class OutputIt>
+        OutputIt overlapping( const Key& lo, const Key& hi, OutputIt out )
+        {
+            return collect_helper(_tree.getRoot(), lo, hi, out);
+        }
+
+        /*              Observers               */
+
+        key_compare key_comp() const
+        {
+            return _tree.key_comp();
+        }
+
+    private:
+        bool overlaps(NodePtr x, const Key& lo, const Key& hi) const
+        {
+            return _comp(_tree.value(x).first.first, hi) && _comp(lo, _tree.value(x).first.second);
+        }
+
+        // If the left subtree reaches past lo but holds no overlap, its
+        // intervals all start at or after hi, and so does the right subtree.
+        NodePtr overlap_helper(const Key& lo, const Key& hi) const
+        {
+            NodePtr x = _tree.getRoot();
+            NodePtr nil = _tree.getNil();
+            while (x != nil && !overlaps(x, lo, hi))
+            {
+                if (x->left != nil && _comp(lo, augment::template value<value_type>(x->left)))
+                    x = x->left;
+                else
+                    x = x->right;
+            }
+            return x == nil ? _tree.getEnd() : x;
+        }
+
+        template <class OutputIt>
+        OutputIt collect_helper(NodePtr x, const Key& lo, const Key& hi, OutputIt out)
+        {
+            NodePtr nil = _tree.getNil();
+            while (x != nil && _comp(lo, augment::template value<value_type>(x)))
+            {
+                out = collect_helper(x->left, lo, hi, out);
+                if (!_comp(_tree.value(x).first.first, hi))
+                    break;
+                if (overlaps(x, lo, hi))
+                    *out++ = iterator(x);
+                x = x->right;
+            }
+            return out;
+        }
+    };
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator==( const ft::interval_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::interval_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator!=( const ft::interval_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::interval_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return !(lhs == rhs);
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    void swap( ft::interval_map<Key,T,Compare,Alloc>& lhs,
+           ft::interval_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return lhs.swap(rhs);
+    }
+}
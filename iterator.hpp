@@ -1,5 +1,6 @@
 #pragma once
 #include  <cstddef>
+#include  <iterator>
 #include "iterator_traits.hpp"
 
 
@@ -59,4 +60,27 @@ namespace ft
 	    return ft::do_distance(first, last, typename ft::iterator_traits<It>::iterator_category());
 	}
 
+	// Reduces a category, ft or std, to input_iterator_tag for single-pass
+	// iterators and forward_iterator_tag for those a range can be read
+	// through twice, e.g. to measure it first.
+	inline ft::input_iterator_tag pass_category(ft::input_iterator_tag)
+	{
+	    return ft::input_iterator_tag();
+	}
+
+	inline ft::forward_iterator_tag pass_category(ft::forward_iterator_tag)
+	{
+	    return ft::forward_iterator_tag();
+	}
+
+	inline ft::input_iterator_tag pass_category(std::input_iterator_tag)
+	{
+	    return ft::input_iterator_tag();
+	}
+
+	inline ft::forward_iterator_tag pass_category(std::forward_iterator_tag)
+	{
+	    return ft::forward_iterator_tag();
+	}
+
 }
\ No newline at end of file
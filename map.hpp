@@ -7,6 +7,7 @@
 #include "algorithm.hpp"
 #include <new>
 #include "RBT.hpp"
+#include "pool_allocator.hpp"
 
 namespace ft
 {
@@ -15,7 +16,8 @@ namespace ft
         class Key,
         class T,
         class Compare = std::less<Key>,
-        class Allocator = std::allocator<ft::pair<const Key, T> >
+        class Allocator = ft::pool_allocator<ft::pair<const Key, T> >,
+        class Augment = ft::no_augment
     > class map
     {
     public:
@@ -46,15 +48,15 @@ namespace ft
             {
                 return val.first;
             }
-            const key_type &operator()(Type &val) const
+            const key_type &operator()(const Type &val) const
             {
                 return val.first;
             }
         };
 
-        typedef  Node<value_type>*                          NodePtr;
+        typedef  rb_node_base*                              NodePtr;
 
-        RBT<value_type, SelectFirst<value_type>, Compare>   _tree;
+        RBT<value_type, SelectFirst<value_type>, Compare, Allocator, Augment>   _tree;
         allocator_type                                      _alloc;
 
         public:
@@ -72,22 +74,22 @@ namespace ft
                 const Allocator& alloc = Allocator(), typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
                 :_tree(comp), _alloc(alloc)
             {
-                while (first != last)
-                {
-                    insert(*first);
-                    ++first;
-                }
+                _tree.insert_range(first, last);
             }
 
             map( const map& other )
             : _tree(other._tree) {}
 
+#if __cplusplus >= 201103L
+            map( map&& other )
+            : _tree(std::move(other._tree)), _alloc(other._alloc) {}
+#endif
+
             /*             Destructor          */
 
             ~map()
             {
                 _tree.delete_all();
-                _tree.delete_NIL();
             }
 
             map& operator=( const map& other )
@@ -96,6 +98,14 @@ namespace ft
                 return *this;
             }
 
+#if __cplusplus >= 201103L
+            map& operator=( map&& other )
+            {
+                _tree = std::move(other._tree);
+                return *this;
+            }
+#endif
+
 
             class value_compare : std::binary_function<value_type, value_type, bool>
 			{
@@ -123,32 +133,39 @@ namespace ft
             T& at( const Key& key )
             {
                 NodePtr ret = _tree.search(key);
-                if (ret == _tree.getNil())
+                if (ret == _tree.getEnd())
                     throw  std::out_of_range("map::at");
                 else
-                    return (ret->key.second);            
+                    return (_tree.value(ret).second);            
             }
 
             const T& at( const Key& key ) const
             {
                 NodePtr ret = _tree.search(key);
-                if (ret == _tree.getNil())
+                if (ret == _tree.getEnd())
                     throw  std::out_of_range("map::at");
                 else
-                    return const_reference(ret->key.second);               
+                    return const_reference(_tree.value(ret).second);               
             }
 
             T& operator[]( const Key& key )
             {
-                return insert(ft::make_pair(key, T())).first->second;
+                return try_emplace(key).first->second;
             }
 
+#if __cplusplus >= 201103L
+            T& operator[]( Key&& key )
+            {
+                return try_emplace(std::move(key)).first->second;
+            }
+#endif
+
             /*              Iterators               */
 
             iterator begin()
             {
                 if (_tree.size() == 0)
-                    return iterator(_tree.getNil());
+                    return iterator(_tree.getEnd());
                 else
                     return iterator(_tree.minimum());
             }
@@ -156,20 +173,20 @@ namespace ft
             const_iterator begin() const
             {
                 if (_tree.size() == 0)
-                    return const_iterator(_tree.getNil());
+                    return const_iterator(_tree.getEnd());
                 else
                     return const_iterator(_tree.minimum());
             }
 
             iterator end()
             {
-                iterator tmp (_tree.getNil());
+                iterator tmp (_tree.getEnd());
                 return tmp;
             }
 
             const_iterator end() const
             {
-                return const_iterator(_tree.getNil());
+                return const_iterator(_tree.getEnd());
             }
 
             reverse_iterator rbegin()
@@ -217,71 +234,109 @@ namespace ft
 
             ft::pair<iterator, bool> insert( const value_type& value )
             {
-                NodePtr tmp = _tree.search(value.first);
-                ft::pair<iterator, bool> ret;
-                if (tmp == _tree.getNil())
-                {
-                    ret.first = iterator(_tree.insert(value));
-                    ret.second = true;
-                }
-                else
-                {
-                    ret.first = iterator(tmp);
-                    ret.second = false;
-                }
-                return ret;
+                ft::pair<NodePtr, bool> ret = _tree.insert_unique(value);
+                return ft::make_pair(iterator(ret.first), ret.second);
+            }
+
+#if __cplusplus >= 201103L
+            ft::pair<iterator, bool> insert( value_type&& value )
+            {
+                ft::pair<NodePtr, bool> ret = _tree.insert_unique(std::move(value));
+                return ft::make_pair(iterator(ret.first), ret.second);
+            }
+
+            template< class... Args >
+            ft::pair<iterator, bool> emplace( Args&&... args )
+            {
+                ft::pair<NodePtr, bool> ret = _tree.emplace_unique(std::forward<Args>(args)...);
+                return ft::make_pair(iterator(ret.first), ret.second);
+            }
+
+            template< class... Args >
+            iterator emplace_hint( const_iterator hint, Args&&... args )
+            {
+                return iterator(_tree.emplace_hint_unique(hint.base(), std::forward<Args>(args)...));
+            }
+
+            // The mapped value is only built when key is not present yet.
+            template< class... Args >
+            ft::pair<iterator, bool> try_emplace( const Key& key, Args&&... args )
+            {
+                NodePtr parent;
+                bool left;
+                NodePtr tmp = _tree.find_insert_position(key, parent, left);
+                if (tmp != _tree.getEnd())
+                    return ft::make_pair(iterator(tmp), false);
+                return ft::make_pair(iterator(_tree.insert_at(parent, left, key,
+                    T(std::forward<Args>(args)...))), true);
+            }
+
+            template< class... Args >
+            ft::pair<iterator, bool> try_emplace( Key&& key, Args&&... args )
+            {
+                NodePtr parent;
+                bool left;
+                NodePtr tmp = _tree.find_insert_position(key, parent, left);
+                if (tmp != _tree.getEnd())
+                    return ft::make_pair(iterator(tmp), false);
+                return ft::make_pair(iterator(_tree.insert_at(parent, left, std::move(key),
+                    T(std::forward<Args>(args)...))), true);
+            }
+#else
+            ft::pair<iterator, bool> try_emplace( const Key& key )
+            {
+                NodePtr parent;
+                bool left;
+                NodePtr tmp = _tree.find_insert_position(key, parent, left);
+                if (tmp != _tree.getEnd())
+                    return ft::make_pair(iterator(tmp), false);
+                return ft::make_pair(iterator(_tree.insert_at(parent, left, value_type(key, T()))), true);
+            }
+
+            ft::pair<iterator, bool> try_emplace( const Key& key, const T& obj )
+            {
+                NodePtr parent;
+                bool left;
+                NodePtr tmp = _tree.find_insert_position(key, parent, left);
+                if (tmp != _tree.getEnd())
+                    return ft::make_pair(iterator(tmp), false);
+                return ft::make_pair(iterator(_tree.insert_at(parent, left, value_type(key, obj))), true);
             }
+#endif
 
             iterator insert( iterator pos, const value_type& value )
             {
-                NodePtr tmp = _tree.search(value.first);
-                if (tmp == _tree.getNil())
-                    return iterator(_tree.insert(pos, value));
-                else
-                    return iterator(tmp);
+                return iterator(_tree.insert(pos, value));
             }
 
             template< class InputIt >
             void insert( InputIt first, InputIt last, typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
             {
-                while (first != last)
-                {
-                    if(_tree.search(first->first) == _tree.getNil())
-                        _tree.insert(*first);
-                    ++first;
-                }
+                _tree.insert_range(first, last);
             }
 
             void erase( iterator pos )
             {
-                _tree.remove(pos->first);
+                _tree.erase_node(pos.base());
             }
 
             void erase( iterator first, iterator last )
             {
-                NodePtr tmp = first.base();
-                value_type last_pair = *last;
-
-                while (tmp->key != last_pair)
-                {
-                   _tree.remove(tmp->key.first);
-                    tmp = _tree.upper_bound(tmp->key.first);
-                }
+                _tree.erase_range(first.base(), last.base());
             }
 
             size_type erase( const Key& key )
             {
-                if (_tree.search(key) != _tree.getNil())
-                {
-                    _tree.remove(key);
-                    return 1;
-                }
-                return 0;
+                NodePtr tmp = _tree.search(key);
+                if (tmp == _tree.getEnd())
+                    return 0;
+                _tree.erase_node(tmp);
+                return 1;
             }
 
             size_type count( const Key& key ) const
             {
-                return (_tree.search(key) == _tree.getNil() ? 0 : 1);
+                return (_tree.search(key) == _tree.getEnd() ? 0 : 1);
             }
 
             iterator find( const Key& key )
@@ -329,6 +384,30 @@ namespace ft
                 this->_tree.swap(other._tree);
             }
 
+            /*              Order statistics            */
+            /*    (require the ft::order_statistic policy)  */
+
+            iterator nth( size_type k )
+            {
+                return iterator(_tree.select(k));
+            }
+
+            const_iterator nth( size_type k ) const
+            {
+                return const_iterator(_tree.select(k));
+            }
+
+            size_type rank( const Key& key ) const
+            {
+                return _tree.rank(key);
+            }
+
+            difference_type distance( const_iterator first, const_iterator last ) const
+            {
+                return static_cast<difference_type>(_tree.index_of(last.base()))
+                    - static_cast<difference_type>(_tree.index_of(first.base()));
+            }
+
             /*              Observers               */
 
             key_compare key_comp() const
@@ -340,53 +419,65 @@ namespace ft
             {
                 return (value_compare(key_compare()));
             }
+
+#ifdef FT_STATS
+            const ft::container_stats& stats() const
+            {
+                return _tree.stats();
+            }
+
+            void reset_stats()
+            {
+                _tree.reset_stats();
+            }
+#endif
     };
 
-    template< class Key, class T, class Compare, class Alloc >
-    bool operator==( const ft::map<Key,T,Compare,Alloc>& lhs,
-                 const ft::map<Key,T,Compare,Alloc>& rhs )
+    template< class Key, class T, class Compare, class Alloc, class Augment >
+    bool operator==( const ft::map<Key,T,Compare,Alloc,Augment>& lhs,
+                 const ft::map<Key,T,Compare,Alloc,Augment>& rhs )
     {
         return ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template< class Key, class T, class Compare, class Alloc >
-    bool operator!=( const ft::map<Key,T,Compare,Alloc>& lhs,
-                 const ft::map<Key,T,Compare,Alloc>& rhs )
+    template< class Key, class T, class Compare, class Alloc, class Augment >
+    bool operator!=( const ft::map<Key,T,Compare,Alloc,Augment>& lhs,
+                 const ft::map<Key,T,Compare,Alloc,Augment>& rhs )
     {
         return !(lhs == rhs);
     }
 
-    template< class Key, class T, class Compare, class Alloc >
-    bool operator<( const ft::map<Key,T,Compare,Alloc>& lhs,
-                const ft::map<Key,T,Compare,Alloc>& rhs )
+    template< class Key, class T, class Compare, class Alloc, class Augment >
+    bool operator<( const ft::map<Key,T,Compare,Alloc,Augment>& lhs,
+                const ft::map<Key,T,Compare,Alloc,Augment>& rhs )
     {
          return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template< class Key, class T, class Compare, class Alloc >
-    bool operator>( const ft::map<Key,T,Compare,Alloc>& lhs,
-                 const ft::map<Key,T,Compare,Alloc>& rhs )
+    template< class Key, class T, class Compare, class Alloc, class Augment >
+    bool operator>( const ft::map<Key,T,Compare,Alloc,Augment>& lhs,
+                 const ft::map<Key,T,Compare,Alloc,Augment>& rhs )
     {
         return rhs < lhs;
     }
 
-    template< class Key, class T, class Compare, class Alloc >
-    bool operator<=( const ft::map<Key,T,Compare,Alloc>& lhs,
-                 const ft::map<Key,T,Compare,Alloc>& rhs )
+    template< class Key, class T, class Compare, class Alloc, class Augment >
+    bool operator<=( const ft::map<Key,T,Compare,Alloc,Augment>& lhs,
+                 const ft::map<Key,T,Compare,Alloc,Augment>& rhs )
     {
         return !(lhs > rhs);
     }
 
-    template< class Key, class T, class Compare, class Alloc >
-    bool operator>=( const ft::map<Key,T,Compare,Alloc>& lhs,
-                 const ft::map<Key,T,Compare,Alloc>& rhs )
+    template< class Key, class T, class Compare, class Alloc, class Augment >
+    bool operator>=( const ft::map<Key,T,Compare,Alloc,Augment>& lhs,
+                 const ft::map<Key,T,Compare,Alloc,Augment>& rhs )
     {
         return !(lhs < rhs);
     }
 
-    template< class Key, class T, class Compare, class Alloc >
-    void swap( ft::map<Key,T,Compare,Alloc>& lhs, 
-           ft::map<Key,T,Compare,Alloc>& rhs )
+    template< class Key, class T, class Compare, class Alloc, class Augment >
+    void swap( ft::map<Key,T,Compare,Alloc,Augment>& lhs, 
+           ft::map<Key,T,Compare,Alloc,Augment>& rhs )
     {
         return lhs.swap(rhs);
     }
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <memory>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+namespace ft
+{
+    // Builds *dst from src through alloc, when src is destroyed right
+    // after: moves when that cannot throw, copies otherwise.
+    template <class Allocator, class T>
+    void relocate(Allocator& alloc, T* dst, T& src)
+    {
+#if __cplusplus >= 201103L
+        std::allocator_traits<Allocator>::construct(alloc, dst, std::move_if_noexcept(src));
+#else
+        alloc.construct(dst, src);
+#endif
+    }
+}
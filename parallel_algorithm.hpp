@@ -0,0 +1,315 @@
+#pragma once
+
+#if __cplusplus >= 201103L
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include "random_access_iterator.hpp"
+#include "thread_pool.hpp"
+
+namespace ft
+{
+    /*
+    ** Parallel versions of sort, stable_sort, for_each, transform and
+    ** reduce over random access ranges (ft::vector iterators, pointers,
+    ** std random access iterators), run on a thread_pool. Ranges are cut
+    ** in a few chunks per thread; below parallel_grain elements per chunk
+    ** the work stays on the calling thread. Functors are called
+    ** concurrently and must be safe to call so.
+    */
+
+    const std::size_t parallel_grain = 1 << 14;
+
+    // ft::random_access_iterator only walks an array; work on the pointer
+    // so std algorithms apply.
+    template <class It>
+    It parallel_unwrap(It it)
+    {
+        return it;
+    }
+
+    template <class T>
+    T* parallel_unwrap(ft::random_access_iterator<T> it)
+    {
+        return it.base();
+    }
+
+    inline std::size_t parallel_chunks(std::size_t n, const thread_pool& pool)
+    {
+        if (pool.size() == 1 || n < 2 * parallel_grain)
+            return 1;
+        std::size_t chunks = n / parallel_grain;
+        return std::min(chunks, 4 * pool.size());
+    }
+
+    // Runs fn(lo, hi) over [0, n) cut in chunks, on the pool.
+    template <class Fn>
+    void parallel_chunked(std::size_t n, std::size_t chunks, thread_pool& pool, Fn fn)
+    {
+        if (chunks <= 1)
+        {
+            fn(std::size_t(0), n);
+            return;
+        }
+        task_group group(pool);
+        for (std::size_t c = 0; c < chunks; ++c)
+        {
+            std::size_t lo = n * c / chunks;
+            std::size_t hi = n * (c + 1) / chunks;
+            group.run([&fn, lo, hi] { fn(lo, hi); });
+        }
+        group.wait();
+    }
+
+    /*              for_each / transform / reduce           */
+
+    template <class RandomIt, class UnaryFunction>
+    void parallel_for_each(RandomIt first, RandomIt last, UnaryFunction f,
+        thread_pool& pool = thread_pool::instance())
+    {
+        auto b = ft::parallel_unwrap(first);
+        std::size_t n = last - first;
+        ft::parallel_chunked(n, ft::parallel_chunks(n, pool), pool,
+            [b, &f](std::size_t lo, std::size_t hi) { std::for_each(b + lo, b + hi, f); });
+    }
+
+    template <class RandomIt, class OutputIt, class UnaryOperation>
+    OutputIt parallel_transform(RandomIt first, RandomIt last, OutputIt d_first,
+        UnaryOperation op, thread_pool& pool = thread_pool::instance())
+    {
+        auto b = ft::parallel_unwrap(first);
+        auto d = ft::parallel_unwrap(d_first);
+        std::size_t n = last - first;
+        ft::parallel_chunked(n, ft::parallel_chunks(n, pool), pool,
+            [b, d, &op](std::size_t lo, std::size_t hi) { std::transform(b + lo, b + hi, d + lo, op); });
+        return d_first + n;
+    }
+
+    template <class RandomIt1, class RandomIt2, class OutputIt, class BinaryOperation>
+    OutputIt parallel_transform(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2,
+        OutputIt d_first, BinaryOperation op, thread_pool& pool = thread_pool::instance())
+    {
+        auto b1 = ft::parallel_unwrap(first1);
+        auto b2 = ft::parallel_unwrap(first2);
+        auto d = ft::parallel_unwrap(d_first);
+        std::size_t n = last1 - first1;
+        ft::parallel_chunked(n, ft::parallel_chunks(n, pool), pool,
+            [b1, b2, d, &op](std::size_t lo, std::size_t hi) {
+                std::transform(b1 + lo, b1 + hi, b2 + lo, d + lo, op);
+            });
+        return d_first + n;
+    }
+
+    // op must be associative and commutative: chunks are folded separately
+    // and their results combined in order after init.
+    template <class RandomIt, class T, class BinaryOperation>
+    T parallel_reduce(RandomIt first, RandomIt last, T init, BinaryOperation op,
+        thread_pool& pool = thread_pool::instance())
+    {
+        auto b = ft::parallel_unwrap(first);
+        std::size_t n = last - first;
+        std::size_t chunks = ft::parallel_chunks(n, pool);
+        if (chunks <= 1)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                init = op(init, b[i]);
+            return init;
+        }
+        std::vector<T> partial(chunks, init);
+        ft::parallel_chunked(chunks, chunks, pool, [&](std::size_t c, std::size_t) {
+            std::size_t lo = n * c / chunks;
+            std::size_t hi = n * (c + 1) / chunks;
+            T acc = b[lo];
+            for (std::size_t i = lo + 1; i < hi; ++i)
+                acc = op(acc, b[i]);
+            partial[c] = acc;
+        });
+        for (std::size_t c = 0; c < chunks; ++c)
+            init = op(init, partial[c]);
+        return init;
+    }
+
+    template <class RandomIt, class T>
+    T parallel_reduce(RandomIt first, RandomIt last, T init,
+        thread_pool& pool = thread_pool::instance())
+    {
+        return ft::parallel_reduce(first, last, init, std::plus<T>(), pool);
+    }
+
+    /*              sort / stable_sort          */
+
+    // Merges [f1, l1) and [f2, l2) into out, splitting the larger run at its
+    // middle and the other one where that middle falls, as tasks of group.
+    // Equal elements keep their order: the left run wins ties.
+    template <class It1, class It2, class Compare>
+    void parallel_merge(task_group& group, It1 f1, It1 l1, It1 f2, It1 l2, It2 out, Compare comp)
+    {
+        for (;;)
+        {
+            std::size_t n1 = l1 - f1;
+            std::size_t n2 = l2 - f2;
+            if (n1 + n2 <= parallel_grain)
+            {
+                std::merge(std::make_move_iterator(f1), std::make_move_iterator(l1),
+                    std::make_move_iterator(f2), std::make_move_iterator(l2), out, comp);
+                return;
+            }
+            It1 m1, m2;
+            if (n1 >= n2)
+            {
+                m1 = f1 + n1 / 2;
+                m2 = std::lower_bound(f2, l2, *m1, comp);
+            }
+            else
+            {
+                m2 = f2 + n2 / 2;
+                m1 = std::upper_bound(f1, l1, *m2, comp);
+            }
+            It2 right = out + (m1 - f1) + (m2 - f2);
+            group.run([&group, m1, l1, m2, l2, right, comp] {
+                ft::parallel_merge(group, m1, l1, m2, l2, right, comp);
+            });
+            l1 = m1;
+            l2 = m2;
+        }
+    }
+
+    // Sorts the chunks with leaf_sort, then merges them pairwise back and
+    // forth between the range and a buffer of n elements, each round in
+    // parallel.
+    template <class It, class Compare, class LeafSort>
+    void parallel_merge_sort(It first, It last, Compare comp, thread_pool& pool, LeafSort leaf_sort)
+    {
+        typedef typename std::iterator_traits<It>::value_type value_type;
+
+        std::size_t n = last - first;
+        std::size_t chunks = 1;
+        while (chunks < pool.size())
+            chunks *= 2;
+        while (chunks > 1 && n / chunks < parallel_grain)
+            chunks /= 2;
+        if (chunks == 1)
+        {
+            leaf_sort(first, last, comp);
+            return;
+        }
+
+        ft::parallel_chunked(n, chunks, pool, [&](std::size_t lo, std::size_t hi) {
+            leaf_sort(first + lo, first + hi, comp);
+        });
+
+        struct buffer
+        {
+            std::allocator<value_type>  alloc;
+            value_type*                 data;
+            std::size_t                 size;
+            std::vector<char>           built;
+            std::size_t                 chunks;
+
+            buffer(std::size_t n, std::size_t c)
+            : data(alloc.allocate(n)), size(n), built(c, 0), chunks(c) {}
+
+            ~buffer()
+            {
+                for (std::size_t c = 0; c < chunks; ++c)
+                    if (built[c])
+                        for (std::size_t i = size * c / chunks; i < size * (c + 1) / chunks; ++i)
+                            data[i].~value_type();
+                alloc.deallocate(data, size);
+            }
+        } buf(n, chunks);
+
+        ft::parallel_chunked(chunks, chunks, pool, [&](std::size_t c, std::size_t) {
+            std::size_t lo = n * c / chunks;
+            std::size_t hi = n * (c + 1) / chunks;
+            std::uninitialized_copy(std::make_move_iterator(first + lo),
+                std::make_move_iterator(first + hi), buf.data + lo);
+            buf.built[c] = 1;
+        });
+
+        // The sorted chunks now live in the buffer; the range holds
+        // moved-from values to merge into.
+        bool in_buffer = true;
+        for (std::size_t width = 1; width < chunks; width *= 2)
+        {
+            task_group group(pool);
+            for (std::size_t c = 0; c < chunks; c += 2 * width)
+            {
+                std::size_t lo = n * c / chunks;
+                std::size_t mid = n * (c + width) / chunks;
+                std::size_t hi = n * (c + 2 * width) / chunks;
+                if (in_buffer)
+                    group.run([&group, &buf, first, lo, mid, hi, comp] {
+                        ft::parallel_merge(group, buf.data + lo, buf.data + mid,
+                            buf.data + mid, buf.data + hi, first + lo, comp);
+                    });
+                else
+                    group.run([&group, &buf, first, lo, mid, hi, comp] {
+                        ft::parallel_merge(group, first + lo, first + mid,
+                            first + mid, first + hi, buf.data + lo, comp);
+                    });
+            }
+            group.wait();
+            in_buffer = !in_buffer;
+        }
+
+        if (in_buffer)
+            ft::parallel_chunked(n, chunks, pool, [&](std::size_t lo, std::size_t hi) {
+                std::move(buf.data + lo, buf.data + hi, first + lo);
+            });
+    }
+
+    struct parallel_leaf_sort
+    {
+        template <class It, class Compare>
+        void operator()(It first, It last, Compare comp) const
+        {
+            std::sort(first, last, comp);
+        }
+    };
+
+    struct parallel_leaf_stable_sort
+    {
+        template <class It, class Compare>
+        void operator()(It first, It last, Compare comp) const
+        {
+            std::stable_sort(first, last, comp);
+        }
+    };
+
+    template <class RandomIt, class Compare>
+    void parallel_sort(RandomIt first, RandomIt last, Compare comp,
+        thread_pool& pool = thread_pool::instance())
+    {
+        ft::parallel_merge_sort(ft::parallel_unwrap(first), ft::parallel_unwrap(last),
+            comp, pool, parallel_leaf_sort());
+    }
+
+    template <class RandomIt>
+    void parallel_sort(RandomIt first, RandomIt last)
+    {
+        typedef typename ft::iterator_traits<RandomIt>::value_type value_type;
+        ft::parallel_sort(first, last, std::less<value_type>());
+    }
+
+    template <class RandomIt, class Compare>
+    void parallel_stable_sort(RandomIt first, RandomIt last, Compare comp,
+        thread_pool& pool = thread_pool::instance())
+    {
+        ft::parallel_merge_sort(ft::parallel_unwrap(first), ft::parallel_unwrap(last),
+            comp, pool, parallel_leaf_stable_sort());
+    }
+
+    template <class RandomIt>
+    void parallel_stable_sort(RandomIt first, RandomIt last)
+    {
+        typedef typename ft::iterator_traits<RandomIt>::value_type value_type;
+        ft::parallel_stable_sort(first, last, std::less<value_type>());
+    }
+}
+
+#endif
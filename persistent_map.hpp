@@ -0,0 +1,888 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#if __cplusplus >= 201103L
+# include <atomic>
+#endif
+#include "reverse_iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+    /*
+    ** Map whose copies share their nodes: copying one, or taking a
+    ** snapshot(), is O(1), and a later write to either side copies only
+    ** the O(log n) nodes on its search path (plus the few a rebalancing
+    ** rotation touches). Nodes are reference counted; those a map owns
+    ** alone are changed in place, so a map nobody shares with costs about
+    ** what a plain AVL tree does.
+    **
+    ** Nodes have no parent links (a shared node has several parents), so
+    ** iterators carry the path from the root. Elements are read-only
+    ** through them: write with operator[], at() or insert/erase. Any write
+    ** invalidates the iterators of that map, never those of its copies.
+    **
+    ** A map and its snapshots can be used from different threads at once,
+    ** each object by one writer or several readers: shared nodes are never
+    ** written, and under C++11 the reference counts are atomic. That needs
+    ** a thread safe allocator, hence std::allocator by default rather
+    ** than ft::pool_allocator.
+    */
+
+    template <class T>
+    struct persistent_node
+    {
+        persistent_node*            left;
+        persistent_node*            right;
+#if __cplusplus >= 201103L
+        std::atomic<std::size_t>    refs;
+#else
+        std::size_t                 refs;
+#endif
+        int                         height;
+        T                           value;
+
+#if __cplusplus >= 201103L
+        template <class... Args>
+        explicit persistent_node(Args&&... args)
+        : left(NULL), right(NULL), refs(1), height(1), value(std::forward<Args>(args)...) {}
+#else
+        explicit persistent_node(const T& v)
+        : left(NULL), right(NULL), refs(1), height(1), value(v) {}
+#endif
+    };
+
+    template <class Key, class T, class Compare, class Allocator>
+    class persistent_map;
+
+    template <class V>
+    class persistent_iterator : public ft::iterator<ft::bidirectional_iterator_tag, V>
+    {
+        template <class, class, class, class> friend class persistent_map;
+
+        typedef persistent_node<V>  node_type;
+
+        // An AVL tree of height 92 would hold more than 2^64 nodes.
+        static const int max_depth = 96;
+
+        const node_type*    root;
+        const node_type*    path[max_depth];   // root first; empty at end()
+        int                 depth;
+
+    public:
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, const V>::iterator_category   iterator_category;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, const V>::value_type          value_type;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, const V>::difference_type     difference_type;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, const V>::pointer             pointer;
+        typedef typename ft::iterator<ft::bidirectional_iterator_tag, const V>::reference           reference;
+
+        persistent_iterator() : root(NULL), depth(0) {}
+
+        explicit persistent_iterator(const node_type* r) : root(r), depth(0) {}
+
+        persistent_iterator(const persistent_iterator& other)
+        : root(other.root), depth(other.depth)
+        {
+            for (int i = 0; i < depth; i++)
+                path[i] = other.path[i];
+        }
+
+        persistent_iterator& operator=(const persistent_iterator& other)
+        {
+            root = other.root;
+            depth = other.depth;
+            for (int i = 0; i < depth; i++)
+                path[i] = other.path[i];
+            return *this;
+        }
+
+        const V& operator*() const
+        {
+            return path[depth - 1]->value;
+        }
+
+        const V* operator->() const
+        {
+            return &path[depth - 1]->value;
+        }
+
+        persistent_iterator& operator++()
+        {
+            const node_type* n = path[depth - 1];
+            if (n->right)
+            {
+                path[depth++] = n->right;
+                push_left();
+                return *this;
+            }
+            // Climb until coming up from a left child.
+            while (--depth != 0 && path[depth - 1]->left != path[depth])
+                ;
+            return *this;
+        }
+
+        persistent_iterator operator++(int)
+        {
+            persistent_iterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        persistent_iterator& operator--()
+        {
+            if (depth == 0)
+            {
+                path[depth++] = root;
+                push_right();
+                return *this;
+            }
+            const node_type* n = path[depth - 1];
+            if (n->left)
+            {
+                path[depth++] = n->left;
+                push_right();
+                return *this;
+            }
+            while (--depth != 0 && path[depth - 1]->right != path[depth])
+                ;
+            return *this;
+        }
+
+        persistent_iterator operator--(int)
+        {
+            persistent_iterator tmp(*this);
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const persistent_iterator& other) const
+        {
+            return node() == other.node();
+        }
+
+        bool operator!=(const persistent_iterator& other) const
+        {
+            return node() != other.node();
+        }
+
+    private:
+        const node_type* node() const
+        {
+            return depth ? path[depth - 1] : NULL;
+        }
+
+        void push_left()
+        {
+            for (const node_type* n = path[depth - 1]->left; n; n = n->left)
+                path[depth++] = n;
+        }
+
+        void push_right()
+        {
+            for (const node_type* n = path[depth - 1]->right; n; n = n->right)
+                path[depth++] = n;
+        }
+    };
+
+    template<
+        class Key,
+        class T,
+        class Compare = std::less<Key>,
+        class Allocator = std::allocator<ft::pair<const Key, T> >
+    > class persistent_map
+    {
+    public:
+
+        typedef Key                                             key_type;
+        typedef T                                               mapped_value;
+        typedef ft::pair<const Key, T>                          value_type;
+        typedef std::size_t                                     size_type;
+        typedef std::ptrdiff_t                                  difference_type;
+        typedef Compare                                         key_compare;
+        typedef Allocator                                       allocator_type;
+        typedef value_type&                                     reference;
+        typedef const value_type&                               const_reference;
+        typedef typename Allocator::pointer                     pointer;
+        typedef typename Allocator::const_pointer               const_pointer;
+        typedef ft::persistent_iterator<value_type>             iterator;
+        typedef ft::persistent_iterator<value_type>             const_iterator;
+        typedef ft::reverse_iterator<iterator>                  reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+    private:
+        typedef ft::persistent_node<value_type>                                 node_type;
+        typedef typename Allocator::template rebind<node_type>::other           node_allocator;
+
+        node_type*      _root;
+        size_type       _size;
+        key_compare     _comp;
+        allocator_type  _alloc;
+        node_allocator  _node_alloc;
+
+    public:
+        /*              Constructors            */
+
+        persistent_map() : _root(NULL), _size(0), _comp(Compare()) {}
+
+        explicit persistent_map( const Compare& comp, const Allocator& alloc = Allocator())
+        : _root(NULL), _size(0), _comp(comp), _alloc(alloc) {}
+
+        explicit persistent_map( const Allocator& alloc )
+        : _root(NULL), _size(0), _comp(Compare()), _alloc(alloc) {}
+
+        template< class InputIt >
+        persistent_map( InputIt first, InputIt last, const Compare& comp = Compare(),
+            const Allocator& alloc = Allocator(), typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+        : _root(NULL), _size(0), _comp(comp), _alloc(alloc)
+        {
+            insert(first, last);
+        }
+
+        // O(1): the copy shares every node.
+        persistent_map( const persistent_map& other )
+        : _root(other._root), _size(other._size), _comp(other._comp),
+          _alloc(other._alloc), _node_alloc(other._node_alloc)
+        {
+            acquire(_root);
+        }
+
+#if __cplusplus >= 201103L
+        persistent_map( persistent_map&& other )
+        : _root(other._root), _size(other._size), _comp(other._comp),
+          _alloc(other._alloc), _node_alloc(other._node_alloc)
+        {
+            other._root = NULL;
+            other._size = 0;
+        }
+#endif
+
+        /*             Destructor          */
+
+        ~persistent_map()
+        {
+            release(_root);
+        }
+
+        persistent_map& operator=( const persistent_map& other )
+        {
+            acquire(other._root);
+            release(_root);
+            _root = other._root;
+            _size = other._size;
+            _comp = other._comp;
+            return *this;
+        }
+
+#if __cplusplus >= 201103L
+        persistent_map& operator=( persistent_map&& other )
+        {
+            if (this == &other)
+                return *this;
+            release(_root);
+            _root = other._root;
+            _size = other._size;
+            _comp = other._comp;
+            other._root = NULL;
+            other._size = 0;
+            return *this;
+        }
+#endif
+
+        // Frozen copy of the current contents, in O(1).
+        persistent_map snapshot() const
+        {
+            return *this;
+        }
+
+        class value_compare
+        {
+            public:
+                value_compare(key_compare c) : _comp(c) {}
+
+                bool operator()(const value_type &lhs, const value_type &rhs) const
+                {
+                    return (this->_comp(lhs.first, rhs.first));
+                }
+
+            protected:
+                key_compare _comp;
+        };
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        /*              Element access          */
+
+        // Copies the shared nodes above the element, which it may change.
+        T& at( const Key& key )
+        {
+            if (!find_node(key))
+                throw std::out_of_range("persistent_map::at");
+            return own_path(key)->value.second;
+        }
+
+        const T& at( const Key& key ) const
+        {
+            const node_type* n = find_node(key);
+            if (!n)
+                throw std::out_of_range("persistent_map::at");
+            return n->value.second;
+        }
+
+        T& operator[]( const Key& key )
+        {
+            if (find_node(key))
+                return own_path(key)->value.second;
+            return add_node(new_node(value_type(key, T())))->value.second;
+        }
+
+        /*              Iterators               */
+
+        const_iterator begin() const
+        {
+            const_iterator it(_root);
+            if (_root)
+            {
+                it.path[it.depth++] = _root;
+                it.push_left();
+            }
+            return it;
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(_root);
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        /*             Capacity                */
+
+        bool empty() const
+        {
+            return _size == 0;
+        }
+
+        size_type size() const
+        {
+            return _size;
+        }
+
+        size_type max_size() const
+        {
+            return _node_alloc.max_size();
+        }
+
+        /*              Modifiers           */
+
+        void clear()
+        {
+            release(_root);
+            _root = NULL;
+            _size = 0;
+        }
+
+        ft::pair<iterator, bool> insert( const value_type& value )
+        {
+            iterator it = find(value.first);
+            if (it != end())
+                return ft::make_pair(it, false);
+            add_node(new_node(value));
+            return ft::make_pair(find(value.first), true);
+        }
+
+#if __cplusplus >= 201103L
+        ft::pair<iterator, bool> insert( value_type&& value )
+        {
+            iterator it = find(value.first);
+            if (it != end())
+                return ft::make_pair(it, false);
+            node_type* z = add_node(new_node(std::move(value)));
+            return ft::make_pair(find(z->value.first), true);
+        }
+#endif
+
+        iterator insert( iterator pos, const value_type& value )
+        {
+            (void)pos;
+            return insert(value).first;
+        }
+
+        template< class InputIt >
+        void insert( InputIt first, InputIt last, typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+        {
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+        void erase( iterator pos )
+        {
+            Key key(pos->first);
+            erase(key);
+        }
+
+        void erase( iterator first, iterator last )
+        {
+            if (first == begin() && last == end())
+            {
+                clear();
+                return;
+            }
+            ft::vector<Key> keys;
+            for (; first != last; ++first)
+                keys.push_back(first->first);
+            for (size_type i = 0; i < keys.size(); i++)
+                erase(keys[i]);
+        }
+
+        size_type erase( const Key& key )
+        {
+            if (!find_node(key))
+                return 0;
+            erase_node(_root, key);
+            --_size;
+            return 1;
+        }
+
+        void swap( persistent_map& other )
+        {
+            std::swap(_root, other._root);
+            std::swap(_size, other._size);
+            std::swap(_comp, other._comp);
+            std::swap(_alloc, other._alloc);
+            std::swap(_node_alloc, other._node_alloc);
+        }
+
+        /*              Lookup              */
+
+        size_type count( const Key& key ) const
+        {
+            return find_node(key) ? 1 : 0;
+        }
+
+        const_iterator find( const Key& key ) const
+        {
+            const_iterator it = lower_bound(key);
+            if (it != end() && _comp(key, it->first))
+                return end();
+            return it;
+        }
+
+        ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        const_iterator lower_bound( const Key& key ) const
+        {
+            return seek(key, false);
+        }
+
+        const_iterator upper_bound( const Key& key ) const
+        {
+            return seek(key, true);
+        }
+
+        /*              Observers               */
+
+        key_compare key_comp() const
+        {
+            return _comp;
+        }
+
+        value_compare value_comp() const
+        {
+            return value_compare(_comp);
+        }
+
+    private:
+        /*              Nodes               */
+
+        static const Key& key_of(const node_type* n)
+        {
+            return n->value.first;
+        }
+
+        static int height(const node_type* n)
+        {
+            return n ? n->height : 0;
+        }
+
+        static void update(node_type* n)
+        {
+            int l = height(n->left);
+            int r = height(n->right);
+            n->height = 1 + (l > r ? l : r);
+        }
+
+        static void acquire(node_type* n)
+        {
+#if __cplusplus >= 201103L
+            if (n)
+                n->refs.fetch_add(1, std::memory_order_relaxed);
+#else
+            if (n)
+                ++n->refs;
+#endif
+        }
+
+        // Drops one reference; true when it was the last one.
+        static bool drop(node_type* n)
+        {
+#if __cplusplus >= 201103L
+            return n->refs.fetch_sub(1, std::memory_order_acq_rel) == 1;
+#else
+            return --n->refs == 0;
+#endif
+        }
+
+        static bool unique(const node_type* n)
+        {
+#if __cplusplus >= 201103L
+            return n->refs.load(std::memory_order_acquire) == 1;
+#else
+            return n->refs == 1;
+#endif
+        }
+
+#if __cplusplus >= 201103L
+        template <class... Args>
+        node_type* new_node(Args&&... args)
+        {
+            node_type* n = _node_alloc.allocate(1);
+            try
+            {
+                ::new (static_cast<void*>(n)) node_type(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                _node_alloc.deallocate(n, 1);
+                throw;
+            }
+            return n;
+        }
+#else
+        node_type* new_node(const value_type& value)
+        {
+            node_type* n = _node_alloc.allocate(1);
+            try
+            {
+                ::new (static_cast<void*>(n)) node_type(value);
+            }
+            catch (...)
+            {
+                _node_alloc.deallocate(n, 1);
+                throw;
+            }
+            return n;
+        }
+#endif
+
+        void free_node(node_type* n)
+        {
+            n->~node_type();
+            _node_alloc.deallocate(n, 1);
+        }
+
+        // Drops a reference to the subtree at n, freeing what nobody else
+        // holds. Recurses left only, so the depth stays within the height.
+        void release(node_type* n)
+        {
+            while (n && drop(n))
+            {
+                release(n->left);
+                node_type* right = n->right;
+                free_node(n);
+                n = right;
+            }
+        }
+
+        // Makes the node at slot one this map alone owns, copying it when
+        // it is shared. The copy is linked before the original is let go,
+        // so a throwing copy leaves the tree as it was.
+        node_type* own(node_type*& slot)
+        {
+            node_type* n = slot;
+            if (unique(n))
+                return n;
+            node_type* c = new_node(n->value);
+            c->left = n->left;
+            c->right = n->right;
+            c->height = n->height;
+            acquire(c->left);
+            acquire(c->right);
+            slot = c;
+            release(n);
+            return c;
+        }
+
+        // Owns every node from the root down to key, which must be there.
+        node_type* own_path(const Key& key)
+        {
+            node_type** slot = &_root;
+            for (;;)
+            {
+                node_type* n = own(*slot);
+                if (_comp(key, key_of(n)))
+                    slot = &n->left;
+                else if (_comp(key_of(n), key))
+                    slot = &n->right;
+                else
+                    return n;
+            }
+        }
+
+        const node_type* find_node(const Key& key) const
+        {
+            const node_type* n = _root;
+            while (n)
+            {
+                if (_comp(key, key_of(n)))
+                    n = n->left;
+                else if (_comp(key_of(n), key))
+                    n = n->right;
+                else
+                    return n;
+            }
+            return NULL;
+        }
+
+        // First element not before key (upper: after key), with its path.
+        const_iterator seek(const Key& key, bool upper) const
+        {
+            const_iterator it(_root);
+            int found = 0;
+            for (const node_type* n = _root; n; )
+            {
+                it.path[it.depth++] = n;
+                if (upper ? _comp(key, key_of(n)) : !_comp(key_of(n), key))
+                {
+                    found = it.depth;
+                    n = n->left;
+                }
+                else
+                    n = n->right;
+            }
+            it.depth = found;
+            return it;
+        }
+
+        /*              Balancing               */
+
+        // Both nodes must be owned.
+        static node_type* rotate_left(node_type* n)
+        {
+            node_type* r = n->right;
+            n->right = r->left;
+            r->left = n;
+            update(n);
+            update(r);
+            return r;
+        }
+
+        static node_type* rotate_right(node_type* n)
+        {
+            node_type* l = n->left;
+            n->left = l->right;
+            l->right = n;
+            update(n);
+            update(l);
+            return l;
+        }
+
+        // n is owned; the children a rotation changes are owned first.
+        // They already are, so this cannot throw: after an insertion they
+        // are on its path, and an erasure owns them with own_sibling().
+        node_type* rebalance(node_type* n)
+        {
+            int balance = height(n->left) - height(n->right);
+            if (balance > 1)
+            {
+                node_type* l = own(n->left);
+                if (height(l->left) < height(l->right))
+                {
+                    own(l->right);
+                    n->left = rotate_left(l);
+                }
+                return rotate_right(n);
+            }
+            if (balance < -1)
+            {
+                node_type* r = own(n->right);
+                if (height(r->right) < height(r->left))
+                {
+                    own(r->left);
+                    n->right = rotate_right(r);
+                }
+                return rotate_left(n);
+            }
+            update(n);
+            return n;
+        }
+
+        // Called before an erasure descends from n to one side: owns what
+        // rebalance(n) may rotate once that side got shorter, which is the
+        // other child, if it is the taller one, and its inner child.
+        void own_sibling(node_type* n, bool left_shrinks)
+        {
+            node_type*& sibling = left_shrinks ? n->right : n->left;
+            if (height(sibling) <= height(left_shrinks ? n->left : n->right))
+                return;
+            node_type* s = own(sibling);
+            node_type*& inner = left_shrinks ? s->left : s->right;
+            if (inner)
+                own(inner);
+        }
+
+        /*              Insert / erase              */
+
+        // Links z, whose key is not in the map, and returns it. Frees z if
+        // copying a shared node on the way throws.
+        node_type* add_node(node_type* z)
+        {
+            try
+            {
+                insert_node(_root, z);
+            }
+            catch (...)
+            {
+                free_node(z);
+                throw;
+            }
+            ++_size;
+            return z;
+        }
+
+        void insert_node(node_type*& slot, node_type* z)
+        {
+            if (!slot)
+            {
+                slot = z;
+                return;
+            }
+            node_type* n = own(slot);
+            if (_comp(key_of(z), key_of(n)))
+                insert_node(n->left, z);
+            else
+                insert_node(n->right, z);
+            slot = rebalance(n);
+        }
+
+        // Unlinks and frees the node of key, which must be in the subtree.
+        // Only copying the nodes on the way down can throw, before anything
+        // is unlinked.
+        void erase_node(node_type*& slot, const Key& key)
+        {
+            node_type* n = own(slot);
+            if (_comp(key, key_of(n)))
+            {
+                own_sibling(n, true);
+                erase_node(n->left, key);
+            }
+            else if (_comp(key_of(n), key))
+            {
+                own_sibling(n, false);
+                erase_node(n->right, key);
+            }
+            else if (!n->left || !n->right)
+            {
+                slot = n->left ? n->left : n->right;
+                free_node(n);
+                return;
+            }
+            else
+            {
+                own_sibling(n, false);
+                node_type* m = take_min(n->right);
+                m->left = n->left;
+                m->right = n->right;
+                slot = m;
+                free_node(n);
+                n = m;
+            }
+            slot = rebalance(n);
+        }
+
+        // Unlinks the smallest node of the subtree and returns it, owned.
+        node_type* take_min(node_type*& slot)
+        {
+            node_type* n = own(slot);
+            if (!n->left)
+            {
+                slot = n->right;
+                n->right = NULL;
+                return n;
+            }
+            own_sibling(n, true);
+            node_type* m = take_min(n->left);
+            slot = rebalance(n);
+            return m;
+        }
+    };
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator==( const ft::persistent_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::persistent_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator!=( const ft::persistent_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::persistent_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return !(lhs == rhs);
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator<( const ft::persistent_map<Key,T,Compare,Alloc>& lhs,
+                const ft::persistent_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator>( const ft::persistent_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::persistent_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return rhs < lhs;
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator<=( const ft::persistent_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::persistent_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return !(lhs > rhs);
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    bool operator>=( const ft::persistent_map<Key,T,Compare,Alloc>& lhs,
+                 const ft::persistent_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return !(lhs < rhs);
+    }
+
+    template< class Key, class T, class Compare, class Alloc >
+    void swap( ft::persistent_map<Key,T,Compare,Alloc>& lhs,
+           ft::persistent_map<Key,T,Compare,Alloc>& rhs )
+    {
+        return lhs.swap(rhs);
+    }
+}
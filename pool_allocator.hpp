@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <limits>
+#include "type_traits.hpp"
+
+namespace ft
+{
+    /*
+    ** Fixed-size object pool with the std::allocator interface.
+    ** Single objects are carved out of slabs that double in size up to
+    ** max_slab_objects, and freed objects are kept on an intrusive free
+    ** list. Requests for more than one object go to operator new.
+    ** Copies share the same pool; the slabs are released with the last copy.
+    */
+    template <class T>
+    class pool_allocator
+    {
+    public:
+        typedef T               value_type;
+        typedef T*              pointer;
+        typedef const T*        const_pointer;
+        typedef T&              reference;
+        typedef const T&        const_reference;
+        typedef std::size_t     size_type;
+        typedef std::ptrdiff_t  difference_type;
+
+        template <class U>
+        struct rebind
+        {
+            typedef pool_allocator<U> other;
+        };
+
+    private:
+        union free_block
+        {
+            free_block* next;
+            char        storage[sizeof(T)];
+            long double align_ld;
+            long long   align_ll;
+        };
+
+        struct slab
+        {
+            slab*       next;
+        };
+
+        struct pool
+        {
+            slab*       slabs;
+            free_block* free_list;
+            free_block* cursor;
+            free_block* end;
+            size_type   next_slab;
+            size_type   refs;
+        };
+
+        static const size_type first_slab_objects = 32;
+        static const size_type max_slab_objects = 4096;
+
+        pool*   _pool;
+
+    public:
+        /*              Constructors            */
+
+        pool_allocator() throw() : _pool(NULL) {}
+
+        pool_allocator(const pool_allocator& other) throw() : _pool(other._pool)
+        {
+            if (_pool)
+                ++_pool->refs;
+        }
+
+        template <class U>
+        pool_allocator(const pool_allocator<U>&) throw() : _pool(NULL) {}
+
+        pool_allocator& operator=(const pool_allocator& other)
+        {
+            if (_pool != other._pool)
+            {
+                release();
+                _pool = other._pool;
+                if (_pool)
+                    ++_pool->refs;
+            }
+            return *this;
+        }
+
+        /*              Destructor              */
+
+        ~pool_allocator()
+        {
+            release();
+        }
+
+        pointer address(reference x) const
+        {
+            return &x;
+        }
+
+        const_pointer address(const_reference x) const
+        {
+            return &x;
+        }
+
+        pointer allocate(size_type n, const void* hint = 0)
+        {
+            (void)hint;
+            if (n != 1)
+                return static_cast<pointer>(::operator new(n * sizeof(T)));
+            if (!_pool)
+            {
+                _pool = new pool();
+                _pool->refs = 1;
+            }
+            if (_pool->free_list)
+            {
+                free_block* block = _pool->free_list;
+                _pool->free_list = block->next;
+                return reinterpret_cast<pointer>(block);
+            }
+            if (_pool->cursor == _pool->end)
+                add_slab();
+            return reinterpret_cast<pointer>(_pool->cursor++);
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            if (!p)
+                return;
+            if (n != 1)
+            {
+                ::operator delete(p);
+                return;
+            }
+            free_block* block = reinterpret_cast<free_block*>(p);
+            block->next = _pool->free_list;
+            _pool->free_list = block;
+        }
+
+        // Frees every object at once by dropping the slabs, unless another
+        // copy shares the pool. The objects are not destroyed.
+        bool purge()
+        {
+            if (_pool && _pool->refs != 1)
+                return false;
+            release();
+            return true;
+        }
+
+        size_type max_size() const throw()
+        {
+            return std::numeric_limits<size_type>::max() / sizeof(T);
+        }
+
+        void construct(pointer p, const_reference val)
+        {
+            new(static_cast<void*>(p)) T(val);
+        }
+
+        void destroy(pointer p)
+        {
+            p->~T();
+        }
+
+        void swap(pool_allocator& other) throw()
+        {
+            pool* tmp = _pool;
+            _pool = other._pool;
+            other._pool = tmp;
+        }
+
+        bool operator==(const pool_allocator& other) const
+        {
+            return _pool == other._pool;
+        }
+
+        bool operator!=(const pool_allocator& other) const
+        {
+            return _pool != other._pool;
+        }
+
+    private:
+        void add_slab()
+        {
+            size_type count = _pool->next_slab ? _pool->next_slab : first_slab_objects;
+            size_type header = (sizeof(slab) + sizeof(free_block) - 1) / sizeof(free_block);
+            free_block* mem = static_cast<free_block*>(::operator new((header + count) * sizeof(free_block)));
+            slab* s = reinterpret_cast<slab*>(mem);
+            s->next = _pool->slabs;
+            _pool->slabs = s;
+            _pool->cursor = mem + header;
+            _pool->end = mem + header + count;
+            if (count < max_slab_objects)
+                _pool->next_slab = count * 2;
+        }
+
+        void release()
+        {
+            if (!_pool || --_pool->refs != 0)
+            {
+                _pool = NULL;
+                return;
+            }
+            slab* s = _pool->slabs;
+            while (s)
+            {
+                slab* next = s->next;
+                ::operator delete(s);
+                s = next;
+            }
+            delete _pool;
+            _pool = NULL;
+        }
+    };
+
+    // Allocators with a purge() member that frees all their objects at
+    // once, which trees use to drop trivially destructible nodes.
+    template <class Alloc> struct allocator_can_purge : false_type {};
+    template <class T> struct allocator_can_purge<pool_allocator<T> > : true_type {};
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <limits>
+#include "type_traits.hpp"
+#if defined(__linux__)
+# include <sys/mman.h>
+#endif
+
+namespace ft
+{
+    /*
+    ** malloc-based allocator that can also resize a block through
+    ** reallocate(), which lets the C library grow it in place when the
+    ** neighbouring memory is free. On Linux, blocks of at least
+    ** mmap_threshold bytes are mapped directly and resized with mremap,
+    ** which moves page table entries instead of copying the contents.
+    ** reallocate() moves elements bytewise, so it is only meant for
+    ** trivially relocatable T.
+    */
+    template <class T>
+    class realloc_allocator
+    {
+    public:
+        typedef T               value_type;
+        typedef T*              pointer;
+        typedef const T*        const_pointer;
+        typedef T&              reference;
+        typedef const T&        const_reference;
+        typedef std::size_t     size_type;
+        typedef std::ptrdiff_t  difference_type;
+
+        template <class U>
+        struct rebind
+        {
+            typedef realloc_allocator<U> other;
+        };
+
+        static const size_type mmap_threshold = 64 * 1024 * 1024;
+
+        /*              Constructors            */
+
+        realloc_allocator() throw() {}
+
+        realloc_allocator(const realloc_allocator&) throw() {}
+
+        template <class U>
+        realloc_allocator(const realloc_allocator<U>&) throw() {}
+
+        /*              Destructor              */
+
+        ~realloc_allocator() {}
+
+        pointer address(reference x) const
+        {
+            return &x;
+        }
+
+        const_pointer address(const_reference x) const
+        {
+            return &x;
+        }
+
+        pointer allocate(size_type n, const void* hint = 0)
+        {
+            (void)hint;
+            if (n > max_size())
+                throw std::bad_alloc();
+            return static_cast<pointer>(raw_allocate(n * sizeof(T)));
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            if (!p)
+                return;
+            raw_deallocate(p, n * sizeof(T));
+        }
+
+        // Resizes the block at p from old_n to new_n elements, keeping the
+        // first min(old_n, new_n) of them, and returns its possibly moved
+        // address. Throws std::bad_alloc and leaves p untouched on failure.
+        pointer reallocate(pointer p, size_type old_n, size_type new_n)
+        {
+            if (!p)
+                return allocate(new_n);
+            if (new_n > max_size())
+                throw std::bad_alloc();
+            size_type old_bytes = old_n * sizeof(T);
+            size_type new_bytes = new_n * sizeof(T);
+            void* q;
+#if defined(__linux__)
+            if (is_mapped(old_bytes) && is_mapped(new_bytes))
+            {
+                q = ::mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+                if (q == MAP_FAILED)
+                    throw std::bad_alloc();
+                return static_cast<pointer>(q);
+            }
+#endif
+            if (!is_mapped(old_bytes) && !is_mapped(new_bytes))
+            {
+                q = std::realloc(p, new_bytes ? new_bytes : 1);
+                if (!q)
+                    throw std::bad_alloc();
+                return static_cast<pointer>(q);
+            }
+            q = raw_allocate(new_bytes);
+            std::memcpy(q, static_cast<const void*>(p), old_bytes < new_bytes ? old_bytes : new_bytes);
+            raw_deallocate(p, old_bytes);
+            return static_cast<pointer>(q);
+        }
+
+        size_type max_size() const throw()
+        {
+            return std::numeric_limits<size_type>::max() / sizeof(T);
+        }
+
+        void construct(pointer p, const_reference val)
+        {
+            new(static_cast<void*>(p)) T(val);
+        }
+
+        void destroy(pointer p)
+        {
+            p->~T();
+        }
+
+        bool operator==(const realloc_allocator&) const
+        {
+            return true;
+        }
+
+        bool operator!=(const realloc_allocator&) const
+        {
+            return false;
+        }
+
+    private:
+        static bool is_mapped(size_type bytes)
+        {
+#if defined(__linux__)
+            return bytes >= mmap_threshold;
+#else
+            (void)bytes;
+            return false;
+#endif
+        }
+
+        static void* raw_allocate(size_type bytes)
+        {
+#if defined(__linux__)
+            if (is_mapped(bytes))
+            {
+                void* p = ::mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (p == MAP_FAILED)
+                    throw std::bad_alloc();
+                return p;
+            }
+#endif
+            void* p = std::malloc(bytes ? bytes : 1);
+            if (!p)
+                throw std::bad_alloc();
+            return p;
+        }
+
+        static void raw_deallocate(void* p, size_type bytes)
+        {
+#if defined(__linux__)
+            if (is_mapped(bytes))
+            {
+                ::munmap(p, bytes);
+                return;
+            }
+#endif
+            std::free(p);
+        }
+    };
+
+    // Allocators with a reallocate(p, old_n, new_n) member that vector
+    // uses to grow buffers of trivially relocatable elements. Specialize
+    // it for other allocators providing one.
+    template <class Alloc> struct allocator_can_reallocate : false_type {};
+    template <class T> struct allocator_can_reallocate<realloc_allocator<T> > : true_type {};
+}
@@ -7,11 +7,12 @@
 #include "algorithm.hpp"
 #include <new>
 #include "RBT.hpp"
+#include "pool_allocator.hpp"
 
 namespace ft
 {
     template<class Key, class Compare = std::less<Key>,
-        class Allocator = std::allocator<Key> >
+        class Allocator = ft::pool_allocator<Key>, class Augment = ft::no_augment >
     class set
     {
     public:
@@ -31,7 +32,7 @@ namespace ft
         typedef ft::reverse_iterator<const_iterator>            reverse_iterator;
         typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
 
-        typedef  Node<value_type>*                              NodePtr;
+        typedef  rb_node_base*                                  NodePtr;
 
     private:
 
@@ -45,13 +46,13 @@ namespace ft
                 return val;
             }
 
-            const T &operator()(T &val) const
+            const T &operator()(const T &val) const
             {
                 return val;
             }
         };
 
-        RBT<value_type, Identity<value_type>, Compare>   _tree;
+        RBT<value_type, Identity<value_type>, Compare, Allocator, Augment>   _tree;
         allocator_type                                   _alloc;
 
     public:
@@ -67,22 +68,22 @@ namespace ft
             typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
             : _tree(comp), _alloc(alloc)
         {
-            while (first != last)
-            {
-                insert(*first);
-                ++first;
-            }
+            _tree.insert_range(first, last);
         }
 
         set( const set& other )
         : _tree(other._tree) {}
 
+#if __cplusplus >= 201103L
+        set( set&& other )
+        : _tree(std::move(other._tree)), _alloc(other._alloc) {}
+#endif
+
         /*              Destructor             */
 
         ~set()
         {
             _tree.delete_all();
-            _tree.delete_NIL();
         }
 
         set& operator=( const set& other )
@@ -91,6 +92,14 @@ namespace ft
             return *this;
         }
 
+#if __cplusplus >= 201103L
+        set& operator=( set&& other )
+        {
+            _tree = std::move(other._tree);
+            return *this;
+        }
+#endif
+
         allocator_type get_allocator() const
         {
             return _alloc;
@@ -101,7 +110,7 @@ namespace ft
         iterator begin()
         {
             if (_tree.size() == 0)
-                return iterator(_tree.getNil());
+                return iterator(_tree.getEnd());
             else
                 return iterator(_tree.minimum());
         }
@@ -109,20 +118,20 @@ namespace ft
         const_iterator begin() const
         {
             if (_tree.size() == 0)
-                return const_iterator(_tree.getNil());
+                return const_iterator(_tree.getEnd());
             else
                 return const_iterator(_tree.minimum());
         }
 
         iterator end()
         {
-            iterator tmp (_tree.getNil());
+            iterator tmp (_tree.getEnd());
             return tmp;
         }
 
         const_iterator end() const
         {
-            return const_iterator(_tree.getNil());
+            return const_iterator(_tree.getEnd());
         }
 
         reverse_iterator rbegin()
@@ -169,66 +178,60 @@ namespace ft
 
         ft::pair<iterator, bool> insert( const value_type& value )
         {
-            NodePtr tmp = _tree.search(value);
-            ft::pair<iterator, bool> ret;
-            if (tmp == _tree.getNil())
-            {
-                ret.first = iterator(_tree.insert(value));
-                ret.second = true;
-            }
-            else
-            {
-                ret.first = iterator(tmp);
-                ret.second = false;
-            }
-            return ret;
+            ft::pair<NodePtr, bool> ret = _tree.insert_unique(value);
+            return ft::make_pair(iterator(ret.first), ret.second);
         }
 
+#if __cplusplus >= 201103L
+        ft::pair<iterator, bool> insert( value_type&& value )
+        {
+            ft::pair<NodePtr, bool> ret = _tree.insert_unique(std::move(value));
+            return ft::make_pair(iterator(ret.first), ret.second);
+        }
+
+        template< class... Args >
+        ft::pair<iterator, bool> emplace( Args&&... args )
+        {
+            ft::pair<NodePtr, bool> ret = _tree.emplace_unique(std::forward<Args>(args)...);
+            return ft::make_pair(iterator(ret.first), ret.second);
+        }
+
+        template< class... Args >
+        iterator emplace_hint( const_iterator hint, Args&&... args )
+        {
+            return iterator(_tree.emplace_hint_unique(hint.base(), std::forward<Args>(args)...));
+        }
+#endif
+
         iterator insert( iterator pos, const value_type& value )
         {
-            NodePtr tmp = _tree.search(value);
-            if (tmp == _tree.getNil())
-                return iterator(_tree.insert(pos, value));
-            else
-                return iterator(tmp);
+            return iterator(_tree.insert(pos, value));
         }
 
 
         template< class InputIt >
         void insert( InputIt first, InputIt last, typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
          {
-            while (first != last)
-            {
-                if(_tree.search(*first) == _tree.getNil())
-                    _tree.insert(*first);
-                ++first;
-            }
+            _tree.insert_range(first, last);
         }
 
         void erase( iterator pos )
          {
-            _tree.remove(*pos);
+            _tree.erase_node(pos.base());
         }
 
         void erase( iterator first, iterator last )
         {
-            NodePtr tmp = first.base();
-            value_type last_pair = *last;
-            while (tmp->key != last_pair)
-            {
-               _tree.remove(tmp->key);
-                tmp = _tree.upper_bound(tmp->key);
-            }
+            _tree.erase_range(first.base(), last.base());
         }
 
         size_type erase( const Key& key )
         {
-            if (_tree.search(key) != _tree.getNil())
-            {
-                _tree.remove(key);
-                return 1;
-            }
-            return 0;
+            NodePtr tmp = _tree.search(key);
+            if (tmp == _tree.getEnd())
+                return 0;
+            _tree.erase_node(tmp);
+            return 1;
         }
 
         void swap( set& other )
@@ -238,7 +241,7 @@ namespace ft
 
         size_type count( const Key& key ) const
         {
-            return (_tree.search(key) == _tree.getNil() ? 0 : 1);
+            return (_tree.search(key) == _tree.getEnd() ? 0 : 1);
         }
 
         iterator find( const Key& key )
@@ -280,6 +283,30 @@ namespace ft
                 return const_iterator(_tree.upper_bound(key));
             }
 
+            /*              Order statistics            */
+            /*    (require the ft::order_statistic policy)  */
+
+            iterator nth( size_type k )
+            {
+                return iterator(_tree.select(k));
+            }
+
+            const_iterator nth( size_type k ) const
+            {
+                return const_iterator(_tree.select(k));
+            }
+
+            size_type rank( const Key& key ) const
+            {
+                return _tree.rank(key);
+            }
+
+            difference_type distance( const_iterator first, const_iterator last ) const
+            {
+                return static_cast<difference_type>(_tree.index_of(last.base()))
+                    - static_cast<difference_type>(_tree.index_of(first.base()));
+            }
+
             key_compare key_comp() const
             {
                 return key_compare();
@@ -289,53 +316,65 @@ namespace ft
             {
                 return (value_compare());
             }
+
+#ifdef FT_STATS
+            const ft::container_stats& stats() const
+            {
+                return _tree.stats();
+            }
+
+            void reset_stats()
+            {
+                _tree.reset_stats();
+            }
+#endif
     };
 
-    template< class Key, class Compare, class Alloc >
-    bool operator==( const ft::set<Key,Compare,Alloc>& lhs,
-                 const ft::set<Key,Compare,Alloc>& rhs )
+    template< class Key, class Compare, class Alloc, class Augment >
+    bool operator==( const ft::set<Key,Compare,Alloc,Augment>& lhs,
+                 const ft::set<Key,Compare,Alloc,Augment>& rhs )
     {
         return ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template< class Key, class Compare, class Alloc >
-    bool operator!=( const ft::set<Key,Compare,Alloc>& lhs,
-                 const ft::set<Key,Compare,Alloc>& rhs )
+    template< class Key, class Compare, class Alloc, class Augment >
+    bool operator!=( const ft::set<Key,Compare,Alloc,Augment>& lhs,
+                 const ft::set<Key,Compare,Alloc,Augment>& rhs )
     {
         return !(lhs == rhs);
     }
 
-    template< class Key, class Compare, class Alloc >
-    bool operator<( const ft::set<Key,Compare,Alloc>& lhs,
-                const ft::set<Key,Compare,Alloc>& rhs )
+    template< class Key, class Compare, class Alloc, class Augment >
+    bool operator<( const ft::set<Key,Compare,Alloc,Augment>& lhs,
+                const ft::set<Key,Compare,Alloc,Augment>& rhs )
     {
          return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template< class Key, class Compare, class Alloc >
-    bool operator>( const ft::set<Key,Compare,Alloc>& lhs,
-                 const ft::set<Key,Compare,Alloc>& rhs )
+    template< class Key, class Compare, class Alloc, class Augment >
+    bool operator>( const ft::set<Key,Compare,Alloc,Augment>& lhs,
+                 const ft::set<Key,Compare,Alloc,Augment>& rhs )
     {
         return rhs < lhs;
     }
 
-    template< class Key, class Compare, class Alloc >
-    bool operator<=( const ft::set<Key,Compare,Alloc>& lhs,
-                 const ft::set<Key,Compare,Alloc>& rhs )
+    template< class Key, class Compare, class Alloc, class Augment >
+    bool operator<=( const ft::set<Key,Compare,Alloc,Augment>& lhs,
+                 const ft::set<Key,Compare,Alloc,Augment>& rhs )
     {
         return !(lhs > rhs);
     }
 
-    template< class Key, class Compare, class Alloc >
-    bool operator>=( const ft::set<Key,Compare,Alloc>& lhs,
-                 const ft::set<Key,Compare,Alloc>& rhs )
+    template< class Key, class Compare, class Alloc, class Augment >
+    bool operator>=( const ft::set<Key,Compare,Alloc,Augment>& lhs,
+                 const ft::set<Key,Compare,Alloc,Augment>& rhs )
     {
         return !(lhs < rhs);
     }
 
-    template< class Key, class Compare, class Alloc >
-    void swap( ft::set<Key,Compare,Alloc>& lhs, 
-           ft::set<Key,Compare,Alloc>& rhs )
+    template< class Key, class Compare, class Alloc, class Augment >
+    void swap( ft::set<Key,Compare,Alloc,Augment>& lhs, 
+           ft::set<Key,Compare,Alloc,Augment>& rhs )
     {
         return lhs.swap(rhs);
     }
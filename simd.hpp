@@ -0,0 +1,325 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__AVX2__)
+# include <immintrin.h>
+#elif defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+namespace ft
+{
+    /*
+    ** Kernels behind the contiguous fast paths in algorithm.hpp.
+    **
+    ** mismatch_bytes picks the widest instruction set the compiler targets
+    ** at compile time (-mavx2, or SSE2 which every x86-64 has); other
+    ** targets get the word-at-a-time loop.
+    **
+    ** The element kernels (simd_find, simd_count, simd_min_index,
+    ** simd_max_index, simd_fill) are written once over GCC vector
+    ** extensions, which lower to whatever the target has. On x86 builds
+    ** that do not already assume AVX2, a second copy is compiled for AVX2
+    ** and chosen at run time when the CPU supports it. Compilers without
+    ** vector extensions get plain loops.
+    */
+
+    inline unsigned int simd_lowest_bit(unsigned int mask)
+    {
+#if defined(__GNUC__)
+        return __builtin_ctz(mask);
+#else
+        unsigned int i = 0;
+        while (!(mask & 1u))
+        {
+            mask >>= 1;
+            ++i;
+        }
+        return i;
+#endif
+    }
+
+    // Offset of the first byte where a and b differ, or n when they don't.
+    inline std::size_t mismatch_bytes(const unsigned char* a, const unsigned char* b, std::size_t n)
+    {
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 32 <= n; i += 32)
+        {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            unsigned int ne = ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+            if (ne)
+                return i + simd_lowest_bit(ne);
+        }
+#endif
+#if defined(__SSE2__)
+        for (; i + 16 <= n; i += 16)
+        {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            unsigned int ne = ~static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xFFFFu;
+            if (ne)
+                return i + simd_lowest_bit(ne);
+        }
+#else
+        for (; i + sizeof(unsigned long) <= n; i += sizeof(unsigned long))
+        {
+            unsigned long x, y;
+            std::memcpy(&x, a + i, sizeof(x));
+            std::memcpy(&y, b + i, sizeof(y));
+            if (x != y)
+                break;
+        }
+#endif
+        for (; i < n; ++i)
+            if (a[i] != b[i])
+                return i;
+        return n;
+    }
+
+#if defined(__GNUC__)
+# define FT_SIMD_VECTOR 1
+# define FT_SIMD_INLINE inline __attribute__((always_inline))
+# if (defined(__x86_64__) || defined(__i386__)) && !defined(__AVX2__)
+#  define FT_SIMD_DISPATCH 1
+# endif
+#endif
+
+#ifdef FT_SIMD_DISPATCH
+    inline bool simd_has_avx2()
+    {
+        static const bool has = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+        return has;
+    }
+#endif
+
+#ifdef FT_SIMD_VECTOR
+    // Signed integer of a given width, the lane type of comparison results.
+    template <std::size_t Size> struct simd_lane;
+    template <> struct simd_lane<1> { typedef signed char type; };
+    template <> struct simd_lane<2> { typedef short type; };
+    template <> struct simd_lane<4> { typedef int type; };
+    template <> struct simd_lane<8> { typedef long long type; };
+
+    // 32 bytes of T: one AVX2 register, or two SSE2 ones.
+    template <class T>
+    struct simd_vector
+    {
+        typedef T type __attribute__((vector_size(32)));
+        typedef typename simd_lane<sizeof(T)>::type lane;
+        typedef lane mask __attribute__((vector_size(32)));
+        typedef long long wide __attribute__((vector_size(32)));
+        static const std::size_t width = 32 / sizeof(T);
+
+        // Out parameters rather than return values: returning a 32-byte
+        // vector from a function built without AVX changes the ABI.
+        static FT_SIMD_INLINE void load(type& v, const T* p)
+        {
+            std::memcpy(&v, p, sizeof(v));
+        }
+
+        static FT_SIMD_INLINE void splat(type& v, T x)
+        {
+            for (std::size_t k = 0; k < width; ++k)
+                v[k] = x;
+        }
+
+        static FT_SIMD_INLINE bool any(const mask& m)
+        {
+            wide w = reinterpret_cast<const wide&>(m);
+            return (w[0] | w[1] | w[2] | w[3]) != 0;
+        }
+    };
+
+    template <class T>
+    FT_SIMD_INLINE std::size_t simd_find_body(const T* p, std::size_t n, T value)
+    {
+        typedef simd_vector<T> V;
+        typename V::type needle, x;
+        V::splat(needle, value);
+        std::size_t i = 0;
+        for (; i + V::width <= n; i += V::width)
+        {
+            V::load(x, p + i);
+            if (V::any(x == needle))
+                break;
+        }
+        for (; i < n; ++i)
+            if (p[i] == value)
+                return i;
+        return n;
+    }
+
+    template <class T>
+    FT_SIMD_INLINE std::size_t simd_count_body(const T* p, std::size_t n, T value)
+    {
+        typedef simd_vector<T> V;
+        typename V::type needle, x;
+        V::splat(needle, value);
+        std::size_t total = 0;
+        std::size_t i = 0;
+        while (i + V::width <= n)
+        {
+            // Matches are -1 lanes; 127 rounds fit even 8-bit counters.
+            typename V::mask acc = typename V::mask();
+            for (int round = 0; round < 127 && i + V::width <= n; ++round, i += V::width)
+            {
+                V::load(x, p + i);
+                acc -= (x == needle);
+            }
+            for (std::size_t k = 0; k < V::width; ++k)
+                total += static_cast<std::size_t>(acc[k]);
+        }
+        for (; i < n; ++i)
+            if (p[i] == value)
+                ++total;
+        return total;
+    }
+
+    // Lanewise extreme of an integral type, then the first index holding it.
+    template <class T, bool Max>
+    FT_SIMD_INLINE std::size_t simd_extreme_body(const T* p, std::size_t n)
+    {
+        typedef simd_vector<T> V;
+        T best = p[0];
+        std::size_t i = 0;
+        if (n >= V::width)
+        {
+            typename V::type acc, x;
+            V::load(acc, p);
+            for (i = V::width; i + V::width <= n; i += V::width)
+            {
+                V::load(x, p + i);
+                acc = (Max ? (x > acc) : (x < acc)) ? x : acc;
+            }
+            best = acc[0];
+            for (std::size_t k = 1; k < V::width; ++k)
+                if (Max ? best < acc[k] : acc[k] < best)
+                    best = acc[k];
+        }
+        for (; i < n; ++i)
+            if (Max ? best < p[i] : p[i] < best)
+                best = p[i];
+        return simd_find_body(p, n, best);
+    }
+
+    template <class T>
+    FT_SIMD_INLINE void simd_fill_body(T* p, std::size_t n, T value)
+    {
+        typedef simd_vector<T> V;
+        typename V::type v;
+        V::splat(v, value);
+        std::size_t i = 0;
+        for (; i + V::width <= n; i += V::width)
+            std::memcpy(p + i, &v, sizeof(v));
+        for (T* end = p + n; p + i != end; ++i)
+            p[i] = value;
+    }
+#else
+    template <class T>
+    inline std::size_t simd_find_body(const T* p, std::size_t n, T value)
+    {
+        std::size_t i = 0;
+        while (i < n && !(p[i] == value))
+            ++i;
+        return i;
+    }
+
+    template <class T>
+    inline std::size_t simd_count_body(const T* p, std::size_t n, T value)
+    {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            if (p[i] == value)
+                ++total;
+        return total;
+    }
+
+    template <class T, bool Max>
+    inline std::size_t simd_extreme_body(const T* p, std::size_t n)
+    {
+        std::size_t best = 0;
+        for (std::size_t i = 1; i < n; ++i)
+            if (Max ? p[best] < p[i] : p[i] < p[best])
+                best = i;
+        return best;
+    }
+
+    template <class T>
+    inline void simd_fill_body(T* p, std::size_t n, T value)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            p[i] = value;
+    }
+#endif
+
+#ifdef FT_SIMD_DISPATCH
+    template <class T> __attribute__((target("avx2")))
+    std::size_t simd_find_avx2(const T* p, std::size_t n, T value) { return simd_find_body(p, n, value); }
+
+    template <class T> __attribute__((target("avx2")))
+    std::size_t simd_count_avx2(const T* p, std::size_t n, T value) { return simd_count_body(p, n, value); }
+
+    template <class T, bool Max> __attribute__((target("avx2")))
+    std::size_t simd_extreme_avx2(const T* p, std::size_t n) { return simd_extreme_body<T, Max>(p, n); }
+
+    template <class T> __attribute__((target("avx2")))
+    void simd_fill_avx2(T* p, std::size_t n, T value) { simd_fill_body(p, n, value); }
+#endif
+
+    // Index of the first element equal to value, or n.
+    template <class T>
+    std::size_t simd_find(const T* p, std::size_t n, T value)
+    {
+#ifdef FT_SIMD_DISPATCH
+        if (simd_has_avx2())
+            return simd_find_avx2(p, n, value);
+#endif
+        return simd_find_body(p, n, value);
+    }
+
+    template <class T>
+    std::size_t simd_count(const T* p, std::size_t n, T value)
+    {
+#ifdef FT_SIMD_DISPATCH
+        if (simd_has_avx2())
+            return simd_count_avx2(p, n, value);
+#endif
+        return simd_count_body(p, n, value);
+    }
+
+    // Index of the first smallest element; n must not be 0. Integral T only.
+    template <class T>
+    std::size_t simd_min_index(const T* p, std::size_t n)
+    {
+#ifdef FT_SIMD_DISPATCH
+        if (simd_has_avx2())
+            return simd_extreme_avx2<T, false>(p, n);
+#endif
+        return simd_extreme_body<T, false>(p, n);
+    }
+
+    // Index of the first largest element; n must not be 0. Integral T only.
+    template <class T>
+    std::size_t simd_max_index(const T* p, std::size_t n)
+    {
+#ifdef FT_SIMD_DISPATCH
+        if (simd_has_avx2())
+            return simd_extreme_avx2<T, true>(p, n);
+#endif
+        return simd_extreme_body<T, true>(p, n);
+    }
+
+    template <class T>
+    void simd_fill(T* p, std::size_t n, T value)
+    {
+#ifdef FT_SIMD_DISPATCH
+        if (simd_has_avx2())
+            return simd_fill_avx2(p, n, value);
+#endif
+        simd_fill_body(p, n, value);
+    }
+}
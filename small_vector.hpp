@@ -0,0 +1,531 @@
+#pragma once
+
+#include <stdexcept>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <cstring>
+#include "type_traits.hpp"
+#include "random_access_iterator.hpp"
+#include "reverse_iterator.hpp"
+#include "algorithm.hpp"
+#include "growth_policy.hpp"
+#include "memory.hpp"
+
+namespace ft
+{
+    /*
+    ** vector that keeps up to N elements in a buffer inside the object and
+    ** only moves to the heap past that. Iterators, growth policies,
+    ** relocation and comparisons are the ones ft::vector uses. Moving or
+    ** swapping a small_vector whose elements are inline relocates them, so
+    ** iterators into it are invalidated.
+    */
+    template<class T, std::size_t N, class Allocator = std::allocator<T>,
+        class Growth = ft::double_growth
+     >class small_vector : public ft::sequence_comparisons<small_vector<T, N, Allocator, Growth> >
+    {
+        public:
+            typedef T										value_type;
+            typedef value_type&								reference;
+            typedef const value_type&						const_reference;
+
+            typedef Allocator								allocator_type;
+            typedef typename Allocator::pointer 			pointer;
+            typedef typename Allocator::const_pointer 	    const_pointer;
+
+            typedef std::size_t								size_type;
+            typedef std::ptrdiff_t							difference_type;
+
+            typedef ft::random_access_iterator<T> 		    iterator;
+            typedef ft::random_access_iterator<const T> 	const_iterator;
+            typedef ft::reverse_iterator<iterator> 		    reverse_iterator;
+            typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+            static const size_type inline_capacity = N;
+
+            /*                          constructors                    */
+            small_vector()
+            : _ptr(inline_ptr()), _capacity(N), _size(0), _allocator(Allocator()) {}
+
+            explicit small_vector( const Allocator& alloc )
+            : _ptr(inline_ptr()), _capacity(N), _size(0), _allocator(alloc) {}
+
+            explicit small_vector( size_type count, const T& value = T(), const Allocator& alloc = Allocator())
+            : _ptr(inline_ptr()), _capacity(N), _size(0), _allocator(alloc)
+            {
+                assign(count, value);
+            }
+
+            template< class InputIt >
+            small_vector( InputIt first, InputIt last, const Allocator& alloc = Allocator(),
+                typename enable_if <!is_integral<InputIt>::value, bool>::type = 0)
+            : _ptr(inline_ptr()), _capacity(N), _size(0), _allocator(alloc)
+            {
+                assign(first, last);
+            }
+
+            small_vector( const small_vector& other )
+            : _ptr(inline_ptr()), _capacity(N), _size(0), _allocator(other._allocator)
+            {
+                assign(other.begin(), other.end());
+            }
+
+#if __cplusplus >= 201103L
+            small_vector( small_vector&& other )
+            : _ptr(inline_ptr()), _capacity(N), _size(0), _allocator(other._allocator)
+            {
+                steal(other);
+            }
+
+            small_vector& operator=( small_vector&& other )
+            {
+                if (this == &other)
+                    return *this;
+                release();
+                steal(other);
+                return *this;
+            }
+#endif
+
+            /*                          destructor                 */
+            ~small_vector()
+            {
+                release();
+            }
+
+            small_vector& operator=( const small_vector& other )
+            {
+                if (this != &other)
+                    assign(other.begin(), other.end());
+                return *this;
+            }
+
+            void assign( size_type count, const T& value )
+            {
+                T copy(value);
+                clear();
+                reserve(count);
+                for (; _size < count; _size++)
+                    _allocator.construct(_ptr + _size, copy);
+            }
+
+            template< class InputIt >
+            void assign(InputIt first, InputIt last,
+                typename ft::enable_if<!ft::is_integral<InputIt>::value, bool>::type* = 0)
+            {
+                clear();
+                append_range(first, last, ft::pass_category(typename ft::iterator_traits<InputIt>::iterator_category()));
+            }
+
+            allocator_type get_allocator() const
+            {
+                return _allocator;
+            }
+
+        /*                      element access                  */
+        reference at( size_type pos )
+        {
+            if (pos >= _size)
+                throw  std::out_of_range("small_vector::at() - Index out of range");
+            return _ptr[pos];
+        }
+
+        const_reference at( size_type pos ) const
+        {
+            if (pos >= _size)
+                throw  std::out_of_range("small_vector::at() - Index out of range");
+            return _ptr[pos];
+        }
+
+        reference operator[]( size_type pos )
+        {
+            return _ptr[pos];
+        }
+
+        const_reference operator[]( size_type pos ) const
+        {
+            return _ptr[pos];
+        }
+
+        reference front()
+        {
+            return _ptr[0];
+        }
+
+        const_reference front() const
+        {
+            return _ptr[0];
+        }
+
+        reference back()
+        {
+            return _ptr[_size - 1];
+        }
+
+        const_reference back() const
+        {
+            return _ptr[_size - 1];
+        }
+
+        T* data()
+        {
+            return _ptr;
+        }
+
+        const T* data() const
+        {
+            return _ptr;
+        }
+
+        /*                          Iterators                  */
+        iterator begin()
+        {
+            return iterator(_ptr);
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(_ptr);
+        }
+
+        iterator end()
+        {
+            return iterator(_ptr + _size);
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(_ptr + _size);
+        }
+
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        /*                          Capacity                  */
+        bool empty() const
+        {
+            return _size == 0;
+        }
+
+        size_type size() const
+        {
+            return _size;
+        }
+
+        size_type max_size() const
+        {
+            return _allocator.max_size();
+        }
+
+        size_type capacity() const
+        {
+            return _capacity;
+        }
+
+        // True while the elements live in the inline buffer.
+        bool is_inline() const
+        {
+            return _ptr == inline_ptr();
+        }
+
+        void reserve( size_type new_cap )
+        {
+            if (new_cap > max_size())
+                throw std::length_error("small_vector::reserve() - Not enough memory");
+            if (new_cap > _capacity)
+                move_to(new_cap);
+        }
+
+        /*                  Modifiers                  */
+        void clear()
+        {
+            for (size_type i = 0; i < _size; i++)
+                _allocator.destroy(_ptr + i);
+            _size = 0;
+        }
+
+        // New elements are appended and then rotated into place.
+        iterator insert( const_iterator pos, const T& value )
+        {
+            return insert(pos, 1, value);
+        }
+
+        iterator insert( const_iterator pos, size_type count, const T& value )
+        {
+            size_type index = (size_type)ft::distance(const_iterator(begin()), pos);
+            size_type old_size = _size;
+            T copy(value);
+            if (_size + count > _capacity)
+                move_to(recommend(_size + count));
+            for (size_type i = 0; i < count; i++)
+                push_back(copy);
+            std::rotate(_ptr + index, _ptr + old_size, _ptr + _size);
+            return iterator(_ptr + index);
+        }
+
+        template< class InputIt >
+        iterator insert( const_iterator pos, InputIt first, InputIt last,
+                        typename enable_if <!is_integral<InputIt>::value, bool>::type = 0)
+        {
+            size_type index = (size_type)ft::distance(const_iterator(begin()), pos);
+            size_type old_size = _size;
+            append_range(first, last, ft::pass_category(typename ft::iterator_traits<InputIt>::iterator_category()));
+            std::rotate(_ptr + index, _ptr + old_size, _ptr + _size);
+            return iterator(_ptr + index);
+        }
+
+        iterator erase( iterator pos )
+        {
+            return erase(pos, pos + 1);
+        }
+
+        iterator erase( iterator first, iterator last )
+        {
+            size_type i = first.base() - _ptr;
+            size_type j = last.base() - _ptr;
+            if (i == j)
+                return first;
+            if (is_trivially_relocatable<T>::value)
+            {
+                for (size_type k = i; k < j; k++)
+                    _allocator.destroy(_ptr + k);
+                if (_size != j)
+                    std::memmove(static_cast<void*>(_ptr + i), static_cast<const void*>(_ptr + j),
+                        (_size - j) * sizeof(T));
+                _size -= j - i;
+                return iterator(_ptr + i);
+            }
+            for (size_type k = j; k < _size; k++)
+                assign_from(_ptr[k - (j - i)], _ptr[k]);
+            for (size_type k = i; k < j; k++)
+                pop_back();
+            return iterator(_ptr + i);
+        }
+
+        void push_back( const T& value )
+        {
+            if (_size == _capacity)
+            {
+                T copy(value);
+                move_to(recommend(_size + 1));
+                _allocator.construct(_ptr + _size, copy);
+            }
+            else
+                _allocator.construct(_ptr + _size, value);
+            _size++;
+        }
+
+#if __cplusplus >= 201103L
+        void push_back( T&& value )
+        {
+            emplace_back(std::move(value));
+        }
+
+        template< class... Args >
+        reference emplace_back( Args&&... args )
+        {
+            if (_size == _capacity)
+            {
+                T tmp(std::forward<Args>(args)...);
+                move_to(recommend(_size + 1));
+                std::allocator_traits<Allocator>::construct(_allocator, _ptr + _size, std::move(tmp));
+            }
+            else
+                std::allocator_traits<Allocator>::construct(_allocator, _ptr + _size,
+                    std::forward<Args>(args)...);
+            return _ptr[_size++];
+        }
+
+        template< class... Args >
+        iterator emplace( const_iterator pos, Args&&... args )
+        {
+            size_type index = (size_type)ft::distance(const_iterator(begin()), pos);
+            emplace_back(std::forward<Args>(args)...);
+            std::rotate(_ptr + index, _ptr + _size - 1, _ptr + _size);
+            return iterator(_ptr + index);
+        }
+
+        iterator insert( const_iterator pos, T&& value )
+        {
+            return emplace(pos, std::move(value));
+        }
+#endif
+
+        void pop_back()
+        {
+            _size--;
+            _allocator.destroy(_ptr + _size);
+        }
+
+        void resize( size_type count, T value = T() )
+        {
+            while (_size > count)
+                pop_back();
+            if (count > _size)
+            {
+                reserve(count);
+                for (; _size != count; _size++)
+                    _allocator.construct(_ptr + _size, value);
+            }
+        }
+
+        void swap( small_vector& other )
+        {
+            if (!is_inline() && !other.is_inline())
+            {
+                std::swap(_ptr, other._ptr);
+                std::swap(_capacity, other._capacity);
+                std::swap(_size, other._size);
+                std::swap(_allocator, other._allocator);
+                return;
+            }
+            small_vector tmp(_allocator);
+            tmp.steal(*this);
+            steal(other);
+            other.steal(tmp);
+        }
+
+        private:
+            union inline_storage
+            {
+                char        bytes[N == 0 ? 1 : N * sizeof(T)];
+                long double align_ld;
+                long long   align_ll;
+                void*       align_p;
+            };
+
+            pointer inline_ptr()
+            {
+                return reinterpret_cast<pointer>(&_inline);
+            }
+
+            const_pointer inline_ptr() const
+            {
+                return reinterpret_cast<const_pointer>(&_inline);
+            }
+
+            // Pushes [first, last) at the end, growing once when the range
+            // can be measured without consuming it.
+            template< class InputIt >
+            void append_range(InputIt first, InputIt last, ft::input_iterator_tag)
+            {
+                for (; first != last; ++first)
+                    push_back(*first);
+            }
+
+            template< class ForwardIt >
+            void append_range(ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
+            {
+                reserve(_size + (size_type)ft::distance(first, last));
+                append_range(first, last, ft::input_iterator_tag());
+            }
+
+            size_type recommend(size_type required) const
+            {
+                return ft::recommend_capacity<Growth>(_capacity, required, sizeof(T), max_size());
+            }
+
+            static void assign_from(T& dst, T& src)
+            {
+#if __cplusplus >= 201103L
+                dst = std::move(src);
+#else
+                dst = src;
+#endif
+            }
+
+            // Moves the elements to a heap buffer of new_cap elements.
+            void move_to(size_type new_cap)
+            {
+                pointer buf = _allocator.allocate(new_cap);
+                if (is_trivially_relocatable<T>::value)
+                {
+                    if (_size != 0)
+                        std::memcpy(static_cast<void*>(buf), static_cast<const void*>(_ptr), _size * sizeof(T));
+                }
+                else
+                {
+                    size_type i = 0;
+                    try
+                    {
+                        for (; i < _size; i++)
+                            ft::relocate(_allocator, buf + i, _ptr[i]);
+                    }
+                    catch(...)
+                    {
+                        while (i != 0)
+                            _allocator.destroy(buf + --i);
+                        _allocator.deallocate(buf, new_cap);
+                        throw;
+                    }
+                    for (i = 0; i < _size; i++)
+                        _allocator.destroy(_ptr + i);
+                }
+                if (!is_inline())
+                    _allocator.deallocate(_ptr, _capacity);
+                _ptr = buf;
+                _capacity = new_cap;
+            }
+
+            // Destroys the elements and returns to the empty inline state.
+            void release()
+            {
+                clear();
+                if (!is_inline())
+                    _allocator.deallocate(_ptr, _capacity);
+                _ptr = inline_ptr();
+                _capacity = N;
+            }
+
+            // Takes over the elements of other, leaving it empty; *this must
+            // be empty and inline. A heap buffer changes hands, inline
+            // elements are relocated one by one.
+            void steal(small_vector& other)
+            {
+                if (!other.is_inline())
+                {
+                    _ptr = other._ptr;
+                    _capacity = other._capacity;
+                    _size = other._size;
+                    _allocator = other._allocator;
+                    other._ptr = other.inline_ptr();
+                    other._capacity = N;
+                    other._size = 0;
+                    return;
+                }
+                for (; _size < other._size; _size++)
+                    ft::relocate(_allocator, _ptr + _size, other._ptr[_size]);
+                other.clear();
+            }
+
+			pointer			_ptr;
+            size_type 		_capacity;
+            size_type 		_size;
+            allocator_type	_allocator;
+            inline_storage  _inline;
+    };
+
+    template <class T, std::size_t N, class Alloc, class Growth>
+    void swap(small_vector<T, N, Alloc, Growth> &v1, small_vector<T, N, Alloc, Growth> &v2)
+    {
+        v1.swap(v2);
+    }
+}
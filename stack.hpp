@@ -1,5 +1,6 @@
 #pragma once
 #include "vector.hpp"
+#include <utility>
 
 namespace ft
 {
@@ -19,6 +20,12 @@ namespace ft
 
             stack( const stack& other ) : c(other.c) {}
 
+#if __cplusplus >= 201103L
+            explicit stack( Container&& cont ) : c(std::move(cont)) {}
+
+            stack( stack&& other ) : c(std::move(other.c)) {}
+#endif
+
             /*                     Destructors                 */
             
             ~stack() {}
@@ -29,6 +36,15 @@ namespace ft
                     this->c = other.c;
                 return *this;
             }
+
+#if __cplusplus >= 201103L
+            stack& operator=( stack&& other )
+            {
+                if (this != &other)
+                    this->c = std::move(other.c);
+                return *this;
+            }
+#endif
             
             /*        Element access            */
 
@@ -61,6 +77,19 @@ namespace ft
                 c.push_back(value);
             }
 
+#if __cplusplus >= 201103L
+            void push( value_type&& value )
+            {
+                c.push_back(std::move(value));
+            }
+
+            template< class... Args >
+            void emplace( Args&&... args )
+            {
+                c.emplace_back(std::forward<Args>(args)...);
+            }
+#endif
+
             void pop()
             {
                 c.pop_back();
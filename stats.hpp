@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ft
+{
+    /*
+    ** Operation counters, built in only with -DFT_STATS. map, set and
+    ** vector then keep one container_stats each (stats(), reset_stats()),
+    ** and every count also goes to global_stats(), which is per thread
+    ** under C++11. Without FT_STATS the containers carry no counters and
+    ** FT_STAT expands to nothing.
+    */
+    struct container_stats
+    {
+        std::size_t comparisons;    // comparator calls
+        std::size_t rotations;      // tree rotations
+        std::size_t fixup_steps;    // rebalancing loop iterations
+        std::size_t allocations;    // nodes or buffers allocated
+        std::size_t deallocations;
+        std::size_t reallocations;  // buffers moved to a larger one
+        std::size_t bytes_copied;   // element bytes moved by reallocations
+
+        container_stats()
+        {
+            reset();
+        }
+
+        void reset()
+        {
+            comparisons = 0;
+            rotations = 0;
+            fixup_steps = 0;
+            allocations = 0;
+            deallocations = 0;
+            reallocations = 0;
+            bytes_copied = 0;
+        }
+
+        container_stats& operator+=(const container_stats& other)
+        {
+            comparisons += other.comparisons;
+            rotations += other.rotations;
+            fixup_steps += other.fixup_steps;
+            allocations += other.allocations;
+            deallocations += other.deallocations;
+            reallocations += other.reallocations;
+            bytes_copied += other.bytes_copied;
+            return *this;
+        }
+    };
+
+#ifdef FT_STATS
+    inline container_stats& global_stats()
+    {
+# if __cplusplus >= 201103L
+        static thread_local container_stats stats;
+# else
+        static container_stats stats;
+# endif
+        return stats;
+    }
+
+# define FT_STAT(stats, field, n) \
+    ((stats).field += (n), ft::global_stats().field += (n))
+#else
+# define FT_STAT(stats, field, n) ((void)0)
+#endif
+}
@@ -0,0 +1,258 @@
+#pragma once
+
+#if __cplusplus >= 201103L
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ft
+{
+    /*
+    ** Work-stealing thread pool for fork-join work (see task_group below).
+    ** A pool of size n runs n - 1 worker threads; the thread that waits on a
+    ** task_group runs tasks too, so n is the parallelism. Every worker owns
+    ** a deque: it pushes and pops at the back, and idle threads steal from
+    ** the front of the others. Tasks pushed from outside the pool go to one
+    ** more deque that everybody steals from.
+    */
+    class thread_pool
+    {
+    public:
+        typedef std::function<void()>   task_type;
+
+        explicit thread_pool(std::size_t threads = 0)
+        : _size(threads ? threads : default_size()), _queues(_size),
+          _queued(0), _stop(false)
+        {
+            _workers.reserve(_size - 1);
+            for (std::size_t i = 0; i + 1 < _size; ++i)
+                _workers.push_back(std::thread(&thread_pool::work, this, i));
+        }
+
+        ~thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_sleep_mutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+            for (std::size_t i = 0; i < _workers.size(); ++i)
+                _workers[i].join();
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        // Shared pool sized to the machine, built on first use.
+        static thread_pool& instance()
+        {
+            static thread_pool pool;
+            return pool;
+        }
+
+        std::size_t size() const
+        {
+            return _size;
+        }
+
+        void push(task_type task)
+        {
+            queue& q = _queues[local_index()];
+            {
+                std::lock_guard<std::mutex> lock(q.mutex);
+                q.tasks.push_back(std::move(task));
+            }
+            _queued.fetch_add(1, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> lock(_sleep_mutex);
+            }
+            _wake.notify_one();
+        }
+
+        // Runs one queued task on the calling thread, if there is any.
+        bool run_one()
+        {
+            task_type task;
+            if (!take(local_index(), task))
+                return false;
+            task();
+            return true;
+        }
+
+    private:
+        struct queue
+        {
+            std::mutex              mutex;
+            std::deque<task_type>   tasks;
+        };
+
+        struct local
+        {
+            thread_pool*    pool;
+            std::size_t     index;
+        };
+
+        static std::size_t default_size()
+        {
+            std::size_t n = std::thread::hardware_concurrency();
+            return n ? n : 1;
+        }
+
+        static local& current()
+        {
+            static thread_local local l = { NULL, 0 };
+            return l;
+        }
+
+        // Own deque for workers, the shared one (the last) for anybody else.
+        std::size_t local_index() const
+        {
+            const local& l = current();
+            return l.pool == this ? l.index : _size - 1;
+        }
+
+        bool take(std::size_t self, task_type& task)
+        {
+            if (_queued.load(std::memory_order_acquire) == 0)
+                return false;
+            {
+                queue& q = _queues[self];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                if (!q.tasks.empty())
+                {
+                    task = std::move(q.tasks.back());
+                    q.tasks.pop_back();
+                    _queued.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            for (std::size_t k = 1; k < _size; ++k)
+            {
+                queue& q = _queues[(self + k) % _size];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                if (!q.tasks.empty())
+                {
+                    task = std::move(q.tasks.front());
+                    q.tasks.pop_front();
+                    _queued.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void work(std::size_t index)
+        {
+            current().pool = this;
+            current().index = index;
+            task_type task;
+            for (;;)
+            {
+                if (take(index, task))
+                {
+                    task();
+                    task = nullptr;
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(_sleep_mutex);
+                _wake.wait(lock, [this] {
+                    return _stop || _queued.load(std::memory_order_acquire) != 0;
+                });
+                if (_stop)
+                    return;
+            }
+        }
+
+        std::size_t                 _size;
+        std::vector<queue>          _queues;
+        std::vector<std::thread>    _workers;
+        std::atomic<std::size_t>    _queued;
+        std::mutex                  _sleep_mutex;
+        std::condition_variable     _wake;
+        bool                        _stop;
+    };
+
+    /*
+    ** A batch of tasks to wait for. wait() runs queued tasks while it waits
+    ** (so nested groups cannot starve the pool) and rethrows the first
+    ** exception a task threw. The group must outlive its tasks: always wait.
+    */
+    class task_group
+    {
+    public:
+        explicit task_group(thread_pool& pool = thread_pool::instance())
+        : _pool(pool), _pending(0) {}
+
+        ~task_group()
+        {
+            while (_pending.load(std::memory_order_acquire) != 0)
+                if (!_pool.run_one())
+                    std::this_thread::yield();
+        }
+
+        task_group(const task_group&) = delete;
+        task_group& operator=(const task_group&) = delete;
+
+        template <class F>
+        void run(F&& f)
+        {
+            if (_pool.size() == 1)
+            {
+                invoke(f);
+                return;
+            }
+            _pending.fetch_add(1, std::memory_order_relaxed);
+            typedef typename std::decay<F>::type fn_type;
+            std::shared_ptr<fn_type> fn = std::make_shared<fn_type>(std::forward<F>(f));
+            _pool.push([this, fn] {
+                invoke(*fn);
+                _pending.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        void wait()
+        {
+            while (_pending.load(std::memory_order_acquire) != 0)
+                if (!_pool.run_one())
+                    std::this_thread::yield();
+            if (_error)
+            {
+                std::exception_ptr e = _error;
+                _error = nullptr;
+                std::rethrow_exception(e);
+            }
+        }
+
+    private:
+        template <class F>
+        void invoke(F& f)
+        {
+            try
+            {
+                f();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(_error_mutex);
+                if (!_error)
+                    _error = std::current_exception();
+            }
+        }
+
+        thread_pool&                _pool;
+        std::atomic<std::size_t>    _pending;
+        std::mutex                  _error_mutex;
+        std::exception_ptr          _error;
+    };
+}
+
+#endif
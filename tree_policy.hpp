@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include "bidirectional_iterator.hpp"
+
+/*
+** Augmentation policies for RBT. A policy picks the node type the tree
+** allocates (always derived from Node<T>, so iterators are unaffected) and
+** recomputes the extra data of a node from its children in update<T>(),
+** which the tree calls after every structural change. Policies with enabled set
+** to false cost nothing.
+*/
+
+namespace ft
+{
+    struct no_augment
+    {
+        static const bool enabled = false;
+
+        template <class T>
+        struct node
+        {
+            typedef Node<T> type;
+        };
+
+        template <class T>
+        static void update(rb_node_base*) {}
+    };
+
+    template <class T>
+    struct counted_node : public Node<T>
+    {
+        std::size_t count;
+
+        counted_node(const T& _key = T()) : Node<T>(_key), count(1) {}
+
+#if __cplusplus >= 201103L
+        template <class... Args>
+        counted_node(rb_emplace_tag tag, Args&&... args)
+            : Node<T>(tag, std::forward<Args>(args)...), count(1) {}
+#endif
+    };
+
+    /*
+    ** Every node stores the size of its subtree, which gives O(log n)
+    ** select (nth element) and rank queries.
+    */
+    struct order_statistic
+    {
+        static const bool enabled = true;
+
+        template <class T>
+        struct node
+        {
+            typedef counted_node<T> type;
+        };
+
+        template <class T>
+        static std::size_t count(const rb_node_base* n)
+        {
+            return n->is_nil() ? 0 : static_cast<const counted_node<T>*>(n)->count;
+        }
+
+        template <class T>
+        static void update(rb_node_base* n)
+        {
+            static_cast<counted_node<T>*>(n)->count = 1 + count<T>(n->left) + count<T>(n->right);
+        }
+    };
+
+    template <class T, class V>
+    struct aggregate_node : public Node<T>
+    {
+        V aggregate;
+
+        aggregate_node(const T& _key = T()) : Node<T>(_key), aggregate() {}
+
+#if __cplusplus >= 201103L
+        template <class... Args>
+        aggregate_node(rb_emplace_tag tag, Args&&... args)
+            : Node<T>(tag, std::forward<Args>(args)...), aggregate() {}
+#endif
+    };
+
+    /*
+    ** Generic subtree aggregate. Op provides value_type, lift(element) and an
+    ** associative combine(a, b); each node stores the in-order combination
+    ** of its subtree, which RBT::fold uses for O(log n) range queries.
+    */
+    template <class Op>
+    struct aggregate_augment
+    {
+        typedef typename Op::value_type value_type;
+
+        static const bool enabled = true;
+
+        template <class T>
+        struct node
+        {
+            typedef aggregate_node<T, value_type> type;
+        };
+
+        template <class T>
+        static const value_type& value(const rb_node_base* n)
+        {
+            return static_cast<const aggregate_node<T, value_type>*>(n)->aggregate;
+        }
+
+        template <class T>
+        static value_type lift(const T& elem)
+        {
+            return Op::lift(elem);
+        }
+
+        static value_type combine(const value_type& a, const value_type& b)
+        {
+            return Op::combine(a, b);
+        }
+
+        template <class T>
+        static void update(rb_node_base* n)
+        {
+            value_type v = Op::lift(static_cast<Node<T>*>(n)->key);
+            if (!n->left->is_nil())
+                v = Op::combine(value<T>(n->left), v);
+            if (!n->right->is_nil())
+                v = Op::combine(v, value<T>(n->right));
+            static_cast<aggregate_node<T, value_type>*>(n)->aggregate = v;
+        }
+    };
+}
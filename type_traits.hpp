@@ -1,5 +1,9 @@
 #pragma once
 
+#if __cplusplus >= 201103L
+# include <type_traits>
+#endif
+
 namespace ft
 {
 	// enable_if
@@ -38,4 +42,75 @@ namespace ft
 	template <> struct is_integral<unsigned int> : true_type {};
 	template <> struct is_integral<unsigned long int> : true_type {};
 	template <> struct is_integral<unsigned long long int> : true_type {};
+
+	// is_floating_point
+	template <class T> struct is_floating_point : false_type {};
+	template <> struct is_floating_point<float> : true_type {};
+	template <> struct is_floating_point<double> : true_type {};
+	template <> struct is_floating_point<long double> : true_type {};
+
+	// is_pointer
+	template <class T> struct is_pointer : false_type {};
+	template <class T> struct is_pointer<T*> : true_type {};
+	template <class T> struct is_pointer<T* const> : true_type {};
+
+	// is_same
+	template <class T, class U> struct is_same : false_type {};
+	template <class T> struct is_same<T, T> : true_type {};
+
+	// remove_cv
+	template <class T> struct remove_cv { typedef T type; };
+	template <class T> struct remove_cv<const T> { typedef T type; };
+	template <class T> struct remove_cv<volatile T> { typedef T type; };
+	template <class T> struct remove_cv<const volatile T> { typedef T type; };
+
+	// is_bitwise_comparable: two objects are equal exactly when their
+	// bytes are, so ranges of them can be compared with memcmp. Not true
+	// of floating point (-0.0 == 0.0, NaN != NaN) nor of types with padding.
+	template <class T> struct is_bitwise_comparable
+		: integral_constant<bool, is_integral<T>::value || is_pointer<T>::value> {};
+
+	// is_trivially_copyable
+#if __cplusplus >= 201103L
+	template <class T> struct is_trivially_copyable
+		: integral_constant<bool, std::is_trivially_copyable<T>::value> {};
+#elif defined(__GNUC__)
+	template <class T> struct is_trivially_copyable
+		: integral_constant<bool, __is_pod(T)> {};
+#else
+	template <class T> struct is_trivially_copyable
+		: integral_constant<bool, is_integral<T>::value || is_floating_point<T>::value
+			|| is_pointer<T>::value> {};
+#endif
+
+	// is_trivially_destructible
+#if __cplusplus >= 201103L
+	template <class T> struct is_trivially_destructible
+		: integral_constant<bool, std::is_trivially_destructible<T>::value> {};
+#elif defined(__GNUC__)
+	template <class T> struct is_trivially_destructible
+		: integral_constant<bool, __has_trivial_destructor(T)> {};
+#else
+	template <class T> struct is_trivially_destructible
+		: integral_constant<bool, is_integral<T>::value || is_floating_point<T>::value
+			|| is_pointer<T>::value> {};
+#endif
+
+	// is_empty: a class without data, so that every default-constructed
+	// object behaves the same. Assumed without compiler support.
+#if __cplusplus >= 201103L
+	template <class T> struct is_empty
+		: integral_constant<bool, std::is_empty<T>::value> {};
+#elif defined(__GNUC__)
+	template <class T> struct is_empty
+		: integral_constant<bool, __is_empty(T)> {};
+#else
+	template <class T> struct is_empty : true_type {};
+#endif
+
+	// is_trivially_relocatable: moving an object to new storage and
+	// forgetting the old one is a plain byte copy. Holds for trivially
+	// copyable types; specialize it to true_type for types that are not
+	// but do not care about their own address, e.g. unique_ptr-like handles.
+	template <class T> struct is_trivially_relocatable : is_trivially_copyable<T> {};
 }
@@ -0,0 +1,404 @@
+#pragma once
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "hash_table.hpp"
+
+namespace ft
+{
+    /*
+    ** Hash map over an open-addressing table (see hash_table.hpp). There
+    ** are no buckets: bucket_count() is the number of slots, and the load
+    ** factor is the fraction of them in use, at most max_load_factor()
+    ** (7/8 by default). Inserting may rehash and invalidate iterators;
+    ** erasing leaves the other elements where they are.
+    */
+    template<
+        class Key,
+        class T,
+        class Hash = ft::hash<Key>,
+        class KeyEqual = std::equal_to<Key>,
+        class Allocator = std::allocator<ft::pair<const Key, T> >
+    > class unordered_map
+    {
+    public:
+
+        typedef Key                                             key_type;
+        typedef T                                               mapped_value;
+        typedef ft::pair<const Key, T>                          value_type;
+        typedef std::size_t                                     size_type;
+        typedef std::ptrdiff_t                                  difference_type;
+        typedef Hash                                            hasher;
+        typedef KeyEqual                                        key_equal;
+        typedef Allocator                                       allocator_type;
+        typedef value_type&                                     reference;
+        typedef const value_type&                               const_reference;
+        typedef typename Allocator::pointer                     pointer;
+        typedef typename Allocator::const_pointer               const_pointer;
+        typedef ft::hash_iterator<value_type>                   iterator;
+        typedef ft::hash_const_iterator<value_type>             const_iterator;
+
+    private:
+
+        template <typename Type>
+        struct SelectFirst
+        {
+            typedef typename Type::first_type key_type;
+            key_type &operator()(Type &val)
+            {
+                return val.first;
+            }
+            const key_type &operator()(const Type &val) const
+            {
+                return val.first;
+            }
+        };
+
+        hash_table<value_type, SelectFirst<value_type>, Hash, KeyEqual, Allocator>    _table;
+        allocator_type                                                              _alloc;
+
+    public:
+        /*              Constructors            */
+
+        unordered_map() : _table() {}
+
+        explicit unordered_map( size_type bucket_count, const Hash& hash = Hash(),
+            const KeyEqual& equal = KeyEqual(), const Allocator& alloc = Allocator() )
+            : _table(bucket_count, hash, equal), _alloc(alloc) {}
+
+        explicit unordered_map( const Allocator& alloc ) : _table(), _alloc(alloc) {}
+
+        template< class InputIt >
+        unordered_map( InputIt first, InputIt last, size_type bucket_count = 0,
+            const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+            const Allocator& alloc = Allocator(),
+            typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+            : _table(bucket_count, hash, equal), _alloc(alloc)
+        {
+            _table.insert_range(first, last);
+        }
+
+        unordered_map( const unordered_map& other )
+        : _table(other._table), _alloc(other._alloc) {}
+
+#if __cplusplus >= 201103L
+        unordered_map( unordered_map&& other )
+        : _table(std::move(other._table)), _alloc(other._alloc) {}
+#endif
+
+        unordered_map& operator=( const unordered_map& other )
+        {
+            _table = other._table;
+            return *this;
+        }
+
+#if __cplusplus >= 201103L
+        unordered_map& operator=( unordered_map&& other )
+        {
+            _table = std::move(other._table);
+            return *this;
+        }
+#endif
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        /*              Element access          */
+
+        T& at( const Key& key )
+        {
+            iterator ret = _table.search(key);
+            if (ret == _table.end())
+                throw std::out_of_range("unordered_map::at");
+            return ret->second;
+        }
+
+        const T& at( const Key& key ) const
+        {
+            iterator ret = _table.search(key);
+            if (ret == _table.end())
+                throw std::out_of_range("unordered_map::at");
+            return ret->second;
+        }
+
+        T& operator[]( const Key& key )
+        {
+            return try_emplace(key).first->second;
+        }
+
+#if __cplusplus >= 201103L
+        T& operator[]( Key&& key )
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+#endif
+
+        /*              Iterators               */
+
+        iterator begin()
+        {
+            return _table.begin();
+        }
+
+        const_iterator begin() const
+        {
+            return _table.begin();
+        }
+
+        iterator end()
+        {
+            return _table.end();
+        }
+
+        const_iterator end() const
+        {
+            return _table.end();
+        }
+
+        /*              Capacity                */
+
+        bool empty() const
+        {
+            return _table.size() == 0;
+        }
+
+        size_type size() const
+        {
+            return _table.size();
+        }
+
+        size_type max_size() const
+        {
+            return _alloc.max_size();
+        }
+
+        /*              Modifiers               */
+
+        void clear()
+        {
+            _table.clear();
+        }
+
+        ft::pair<iterator, bool> insert( const value_type& value )
+        {
+            return _table.insert_unique(value);
+        }
+
+#if __cplusplus >= 201103L
+        ft::pair<iterator, bool> insert( value_type&& value )
+        {
+            return _table.insert_unique(std::move(value));
+        }
+
+        template< class... Args >
+        ft::pair<iterator, bool> emplace( Args&&... args )
+        {
+            return _table.emplace_unique(std::forward<Args>(args)...);
+        }
+
+        template< class... Args >
+        iterator emplace_hint( const_iterator hint, Args&&... args )
+        {
+            (void)hint;
+            return _table.emplace_unique(std::forward<Args>(args)...).first;
+        }
+
+        // The mapped value is only built when key is not present yet.
+        template< class... Args >
+        ft::pair<iterator, bool> try_emplace( const Key& key, Args&&... args )
+        {
+            size_type hash;
+            iterator it = _table.find_insert_position(key, hash);
+            if (it != _table.end())
+                return ft::make_pair(it, false);
+            return ft::make_pair(_table.insert_at(hash, value_type(key,
+                T(std::forward<Args>(args)...))), true);
+        }
+
+        template< class... Args >
+        ft::pair<iterator, bool> try_emplace( Key&& key, Args&&... args )
+        {
+            size_type hash;
+            iterator it = _table.find_insert_position(key, hash);
+            if (it != _table.end())
+                return ft::make_pair(it, false);
+            return ft::make_pair(_table.insert_at(hash, value_type(std::move(key),
+                T(std::forward<Args>(args)...))), true);
+        }
+#else
+        ft::pair<iterator, bool> try_emplace( const Key& key )
+        {
+            size_type hash;
+            iterator it = _table.find_insert_position(key, hash);
+            if (it != _table.end())
+                return ft::make_pair(it, false);
+            return ft::make_pair(_table.insert_at(hash, value_type(key, T())), true);
+        }
+
+        ft::pair<iterator, bool> try_emplace( const Key& key, const T& obj )
+        {
+            size_type hash;
+            iterator it = _table.find_insert_position(key, hash);
+            if (it != _table.end())
+                return ft::make_pair(it, false);
+            return ft::make_pair(_table.insert_at(hash, value_type(key, obj)), true);
+        }
+#endif
+
+        iterator insert( const_iterator hint, const value_type& value )
+        {
+            (void)hint;
+            return _table.insert_unique(value).first;
+        }
+
+        template< class InputIt >
+        void insert( InputIt first, InputIt last, typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+        {
+            _table.insert_range(first, last);
+        }
+
+        iterator erase( const_iterator pos )
+        {
+            iterator it = unconst(pos);
+            iterator next = it;
+            ++next;
+            _table.erase(it);
+            return next;
+        }
+
+        iterator erase( const_iterator first, const_iterator last )
+        {
+            _table.erase_range(unconst(first), unconst(last));
+            return unconst(last);
+        }
+
+        size_type erase( const Key& key )
+        {
+            return _table.erase_key(key);
+        }
+
+        void swap( unordered_map& other )
+        {
+            _table.swap(other._table);
+        }
+
+        /*              Lookup                  */
+
+        size_type count( const Key& key ) const
+        {
+            return (_table.search(key) == _table.end() ? 0 : 1);
+        }
+
+        iterator find( const Key& key )
+        {
+            return _table.search(key);
+        }
+
+        const_iterator find( const Key& key ) const
+        {
+            return _table.search(key);
+        }
+
+        ft::pair<iterator,iterator> equal_range( const Key& key )
+        {
+            iterator it = _table.search(key);
+            iterator next = it;
+            if (it != _table.end())
+                ++next;
+            return ft::make_pair(it, next);
+        }
+
+        ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const
+        {
+            iterator it = _table.search(key);
+            iterator next = it;
+            if (it != _table.end())
+                ++next;
+            return ft::make_pair(const_iterator(it), const_iterator(next));
+        }
+
+        /*              Hash policy             */
+
+        size_type bucket_count() const
+        {
+            return _table.capacity();
+        }
+
+        float load_factor() const
+        {
+            return _table.capacity() ? static_cast<float>(_table.size()) / _table.capacity() : 0.0f;
+        }
+
+        float max_load_factor() const
+        {
+            return _table.max_load_factor();
+        }
+
+        void max_load_factor( float ml )
+        {
+            _table.max_load_factor(ml);
+        }
+
+        void rehash( size_type count )
+        {
+            _table.rehash(count);
+        }
+
+        void reserve( size_type count )
+        {
+            _table.reserve(count);
+        }
+
+        /*              Observers               */
+
+        hasher hash_function() const
+        {
+            return _table.hash_function();
+        }
+
+        key_equal key_eq() const
+        {
+            return _table.key_eq();
+        }
+
+    private:
+        static iterator unconst( const_iterator it )
+        {
+            return iterator(it.base(), it.slot_ptr());
+        }
+    };
+
+    template< class Key, class T, class Hash, class KeyEqual, class Alloc >
+    bool operator==( const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& lhs,
+                 const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& rhs )
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        typedef typename ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>::const_iterator const_iterator;
+        for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+        {
+            const_iterator other = rhs.find(it->first);
+            if (other == rhs.end() || !(other->second == it->second))
+                return false;
+        }
+        return true;
+    }
+
+    template< class Key, class T, class Hash, class KeyEqual, class Alloc >
+    bool operator!=( const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& lhs,
+                 const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& rhs )
+    {
+        return !(lhs == rhs);
+    }
+
+    template< class Key, class T, class Hash, class KeyEqual, class Alloc >
+    void swap( ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& lhs,
+           ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& rhs )
+    {
+        return lhs.swap(rhs);
+    }
+}
@@ -0,0 +1,301 @@
+#pragma once
+
+#include <memory>
+#include <functional>
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "hash_table.hpp"
+
+namespace ft
+{
+    /*
+    ** Hash set over an open-addressing table (see hash_table.hpp and
+    ** unordered_map.hpp for the sizing rules).
+    */
+    template<class Key, class Hash = ft::hash<Key>,
+        class KeyEqual = std::equal_to<Key>, class Allocator = std::allocator<Key> >
+    class unordered_set
+    {
+    public:
+        typedef Key                                             key_type;
+        typedef Key                                             value_type;
+        typedef std::size_t                                     size_type;
+        typedef std::ptrdiff_t                                  difference_type;
+        typedef Hash                                            hasher;
+        typedef KeyEqual                                        key_equal;
+        typedef Allocator                                       allocator_type;
+        typedef value_type&                                     reference;
+        typedef const value_type&                               const_reference;
+        typedef typename Allocator::pointer                     pointer;
+        typedef typename Allocator::const_pointer               const_pointer;
+        typedef ft::hash_const_iterator<value_type>             iterator;
+        typedef ft::hash_const_iterator<value_type>             const_iterator;
+
+    private:
+
+        template <typename T>
+        struct Identity
+        {
+            typedef T key_type;
+            T &operator()(T &val)
+            {
+                return val;
+            }
+
+            const T &operator()(const T &val) const
+            {
+                return val;
+            }
+        };
+
+        typedef hash_table<value_type, Identity<value_type>, Hash, KeyEqual, Allocator>    table_type;
+        typedef typename table_type::iterator                                               table_iterator;
+
+        table_type                                          _table;
+        allocator_type                                      _alloc;
+
+    public:
+        /*              Constructors            */
+
+        unordered_set() : _table() {}
+
+        explicit unordered_set( size_type bucket_count, const Hash& hash = Hash(),
+            const KeyEqual& equal = KeyEqual(), const Allocator& alloc = Allocator() )
+            : _table(bucket_count, hash, equal), _alloc(alloc) {}
+
+        template< class InputIt >
+        unordered_set( InputIt first, InputIt last, size_type bucket_count = 0,
+            const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+            const Allocator& alloc = Allocator(),
+            typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+            : _table(bucket_count, hash, equal), _alloc(alloc)
+        {
+            _table.insert_range(first, last);
+        }
+
+        unordered_set( const unordered_set& other )
+        : _table(other._table), _alloc(other._alloc) {}
+
+#if __cplusplus >= 201103L
+        unordered_set( unordered_set&& other )
+        : _table(std::move(other._table)), _alloc(other._alloc) {}
+#endif
+
+        unordered_set& operator=( const unordered_set& other )
+        {
+            _table = other._table;
+            return *this;
+        }
+
+#if __cplusplus >= 201103L
+        unordered_set& operator=( unordered_set&& other )
+        {
+            _table = std::move(other._table);
+            return *this;
+        }
+#endif
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        /*              Iterators               */
+
+        iterator begin() const
+        {
+            return _table.begin();
+        }
+
+        iterator end() const
+        {
+            return _table.end();
+        }
+
+        /*              Capacity            */
+
+        bool empty() const
+        {
+            return _table.size() == 0;
+        }
+
+        size_type size() const
+        {
+            return _table.size();
+        }
+
+        size_type max_size() const
+        {
+            return _alloc.max_size();
+        }
+
+        /*              Modifiers           */
+
+        void clear()
+        {
+            _table.clear();
+        }
+
+        ft::pair<iterator, bool> insert( const value_type& value )
+        {
+            ft::pair<table_iterator, bool> ret = _table.insert_unique(value);
+            return ft::make_pair(iterator(ret.first), ret.second);
+        }
+
+#if __cplusplus >= 201103L
+        ft::pair<iterator, bool> insert( value_type&& value )
+        {
+            ft::pair<table_iterator, bool> ret = _table.insert_unique(std::move(value));
+            return ft::make_pair(iterator(ret.first), ret.second);
+        }
+
+        template< class... Args >
+        ft::pair<iterator, bool> emplace( Args&&... args )
+        {
+            ft::pair<table_iterator, bool> ret = _table.emplace_unique(std::forward<Args>(args)...);
+            return ft::make_pair(iterator(ret.first), ret.second);
+        }
+
+        template< class... Args >
+        iterator emplace_hint( const_iterator hint, Args&&... args )
+        {
+            (void)hint;
+            return _table.emplace_unique(std::forward<Args>(args)...).first;
+        }
+#endif
+
+        iterator insert( const_iterator hint, const value_type& value )
+        {
+            (void)hint;
+            return _table.insert_unique(value).first;
+        }
+
+        template< class InputIt >
+        void insert( InputIt first, InputIt last, typename ft::enable_if <!ft::is_integral<InputIt>::value, bool>::type = 0)
+        {
+            _table.insert_range(first, last);
+        }
+
+        iterator erase( const_iterator pos )
+        {
+            iterator next = pos;
+            ++next;
+            _table.erase(unconst(pos));
+            return next;
+        }
+
+        iterator erase( const_iterator first, const_iterator last )
+        {
+            _table.erase_range(unconst(first), unconst(last));
+            return last;
+        }
+
+        size_type erase( const Key& key )
+        {
+            return _table.erase_key(key);
+        }
+
+        void swap( unordered_set& other )
+        {
+            _table.swap(other._table);
+        }
+
+        /*              Lookup              */
+
+        size_type count( const Key& key ) const
+        {
+            return (_table.search(key) == _table.end() ? 0 : 1);
+        }
+
+        iterator find( const Key& key ) const
+        {
+            return _table.search(key);
+        }
+
+        ft::pair<iterator,iterator> equal_range( const Key& key ) const
+        {
+            iterator it = find(key);
+            iterator next = it;
+            if (it != end())
+                ++next;
+            return ft::make_pair(it, next);
+        }
+
+        /*              Hash policy             */
+
+        size_type bucket_count() const
+        {
+            return _table.capacity();
+        }
+
+        float load_factor() const
+        {
+            return _table.capacity() ? static_cast<float>(_table.size()) / _table.capacity() : 0.0f;
+        }
+
+        float max_load_factor() const
+        {
+            return _table.max_load_factor();
+        }
+
+        void max_load_factor( float ml )
+        {
+            _table.max_load_factor(ml);
+        }
+
+        void rehash( size_type count )
+        {
+            _table.rehash(count);
+        }
+
+        void reserve( size_type count )
+        {
+            _table.reserve(count);
+        }
+
+        /*              Observers               */
+
+        hasher hash_function() const
+        {
+            return _table.hash_function();
+        }
+
+        key_equal key_eq() const
+        {
+            return _table.key_eq();
+        }
+
+    private:
+        static table_iterator unconst( const_iterator it )
+        {
+            return table_iterator(it.base(), it.slot_ptr());
+        }
+    };
+
+    template< class Key, class Hash, class KeyEqual, class Alloc >
+    bool operator==( const ft::unordered_set<Key,Hash,KeyEqual,Alloc>& lhs,
+                 const ft::unordered_set<Key,Hash,KeyEqual,Alloc>& rhs )
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        typedef typename ft::unordered_set<Key,Hash,KeyEqual,Alloc>::const_iterator const_iterator;
+        for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+            if (rhs.find(*it) == rhs.end())
+                return false;
+        return true;
+    }
+
+    template< class Key, class Hash, class KeyEqual, class Alloc >
+    bool operator!=( const ft::unordered_set<Key,Hash,KeyEqual,Alloc>& lhs,
+                 const ft::unordered_set<Key,Hash,KeyEqual,Alloc>& rhs )
+    {
+        return !(lhs == rhs);
+    }
+
+    template< class Key, class Hash, class KeyEqual, class Alloc >
+    void swap( ft::unordered_set<Key,Hash,KeyEqual,Alloc>& lhs,
+           ft::unordered_set<Key,Hash,KeyEqual,Alloc>& rhs )
+    {
+        return lhs.swap(rhs);
+    }
+}
@@ -1,5 +1,10 @@
 #pragma once
 
+#if __cplusplus >= 201103L
+# include <utility>
+# include <type_traits>
+#endif
+
 namespace ft
 {
     template <class T1, class T2>
@@ -18,6 +23,15 @@ namespace ft
         template< class U1, class U2 >
         pair( const pair<U1, U2>& p ) : first(p.first), second(p.second) {}
 
+#if __cplusplus >= 201103L
+        template< class U1, class U2, class = typename std::enable_if<
+            std::is_constructible<T1, U1&&>::value && std::is_constructible<T2, U2&&>::value>::type >
+        pair( U1&& x, U2&& y ) : first(std::forward<U1>(x)), second(std::forward<U2>(y)) {}
+
+        template< class U1, class U2 >
+        pair( pair<U1, U2>&& p ) : first(std::forward<U1>(p.first)), second(std::forward<U2>(p.second)) {}
+#endif
+
         template< class U1, class U2 >
         pair &operator=(const pair<U1, U2>& p)
         {
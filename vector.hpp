@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <iterator>
 #include <stdexcept>
 #include <exception>
@@ -7,18 +8,20 @@
 #include "random_access_iterator.hpp"
 #include "reverse_iterator.hpp"
 #include "algorithm.hpp"
+#include "realloc_allocator.hpp"
+#include "growth_policy.hpp"
+#include "stats.hpp"
+#include "memory.hpp"
 #include <iostream>
+#include <memory>
+#include <utility>
+#include <cstring>
 
 namespace ft
 {
-    template <typename T>
-    void swap(T &a1, T &a2)
-    {
-        a1.swap(a2);
-    }
-
-    template<class T, class Allocator = std::allocator<T>
-     >class vector
+    template<class T, class Allocator = std::allocator<T>,
+        class Growth = ft::double_growth
+     >class vector : public ft::sequence_comparisons<vector<T, Allocator, Growth> >
     {
         public:
             typedef T										value_type;
@@ -51,7 +54,7 @@ namespace ft
                 _size = count;
                 try
                 {
-                    _ptr = _allocator.allocate(count);
+                    _ptr = allocate_buffer(count);
                     for (size_type i = 0; i < _size; i++)
                         _allocator.construct(_ptr + i, value);     
                 }
@@ -70,10 +73,10 @@ namespace ft
             : _ptr(NULL), _capacity(0), _size(0), _allocator(alloc)
             {
                 difference_type n = ft::distance(first, last);
-                _capacity = n / sizeof(T);
+                _capacity = n;
                 try
                 {
-                    _ptr = n == 0 ? NULL : _allocator.allocate(_capacity);
+                    _ptr = n == 0 ? NULL : allocate_buffer(_capacity);
                 }
                 catch(const std::exception& e)
                 {
@@ -95,7 +98,7 @@ namespace ft
             {
                 try
                 {
-                    _ptr = _allocator.allocate(_capacity);
+                    _ptr = allocate_buffer(_capacity);
                     for (size_type i = 0; i < _size; i++)
                         _allocator.construct(_ptr + i, other._ptr[i]);
                 }
@@ -132,12 +135,7 @@ namespace ft
                 typename ft::enable_if<!ft::is_integral<InputIt>::value, bool>::type* = 0)
             {
                 this->clear();
-                while (first != last)
-                {
-                    this->push_back((*first));       
-                    ++first;
-                }
-               
+                assign_range(first, last, ft::pass_category(typename ft::iterator_traits<InputIt>::iterator_category()));
             }
 
             /*                          destructor                 */
@@ -145,7 +143,7 @@ namespace ft
             {
                 for(size_type i = 0; i < _size; i++)
                     _allocator.destroy(_ptr + i);
-                _allocator.deallocate(_ptr, _capacity);
+                deallocate_buffer(_ptr, _capacity);
             }
 
             allocator_type get_allocator() const
@@ -158,12 +156,12 @@ namespace ft
                 if (this == &other)
                     return *this;
                 clear();
-                _allocator.deallocate(_ptr, _capacity);
+                deallocate_buffer(_ptr, _capacity);
                 _capacity = other._capacity;
                 _size = other._size;
                 try
                 {
-                    _ptr = _allocator.allocate(_capacity);
+                    _ptr = allocate_buffer(_capacity);
                 }
                 catch(const std::exception& e)
                 {
@@ -179,6 +177,32 @@ namespace ft
                 
             }
 
+#if __cplusplus >= 201103L
+            vector( vector&& other ) noexcept
+            : _ptr(other._ptr), _capacity(other._capacity), _size(other._size),
+              _allocator(std::move(other._allocator))
+            {
+                other._ptr = NULL;
+                other._capacity = 0;
+                other._size = 0;
+            }
+
+            vector& operator=( vector&& other ) noexcept
+            {
+                if (this == &other)
+                    return *this;
+                clear();
+                deallocate_buffer(_ptr, _capacity);
+                _ptr = other._ptr;
+                _capacity = other._capacity;
+                _size = other._size;
+                other._ptr = NULL;
+                other._capacity = 0;
+                other._size = 0;
+                return *this;
+            }
+#endif
+
         /*                      element access                  */
         reference at( size_type pos )
         {
@@ -271,26 +295,51 @@ namespace ft
 
         iterator insert( const_iterator pos, size_type count, const T& value )
         {
+            if (is_trivially_relocatable<T>::value && count != 0)
+            {
+                size_type dist = (size_type)ft::distance(const_iterator(begin()), pos);
+                size_type new_cap = count + _size > _capacity ? recommend(count + _size) : _capacity;
+                T copy(value);
+                pointer buf = open_gap(dist, count, new_cap);
+                size_type i = 0;
+                try
+                {
+                    for (; i < count; i++)
+                        _allocator.construct(buf + dist + i, copy);
+                }
+                catch(...)
+                {
+                    for (size_type j = 0; j < i; j++)
+                        _allocator.destroy(buf + dist + j);
+                    abort_gap(buf, dist, count, new_cap);
+                    throw;
+                }
+                commit_gap(buf, count, new_cap);
+                return iterator(_ptr + dist);
+            }
             if (_size == _capacity && _size == 0)
             {
+                reserve(count);
                 for (size_t i = 0 ; i < count; i++)
                     push_back(value); 
                 return (iterator(_ptr));
             }
             size_type old_cap = _capacity;
             size_type dist = (size_type)ft::distance(const_iterator(begin()), pos);
+            T copy(value);
             T* tmp_ptr;
             if (count + _size > _capacity)
-                _capacity = count + _size;
+                _capacity = recommend(count + _size);
             try
             {
-                tmp_ptr = this->_allocator.allocate(_capacity);
+                tmp_ptr = allocate_buffer(_capacity);
+                note_reallocation();
             }
             catch(...)
             {
                 for(size_type j = 0; j < _size; j++)
                     this->_allocator.destroy(_ptr + j);
-                _allocator.deallocate(_ptr, old_cap);
+                deallocate_buffer(_ptr, old_cap);
                 _size = 0;
                 _capacity = 0;
                 _ptr = NULL;
@@ -299,17 +348,17 @@ namespace ft
             size_type i = 0, tmp_i = 0;
 
             for (; i < dist; tmp_i++, i++)
-                this->_allocator.construct(tmp_ptr + tmp_i, _ptr[i]);
+                ft::relocate(_allocator, tmp_ptr + tmp_i, _ptr[i]);
 
             for (; tmp_i < dist + count; tmp_i++)
-                this->_allocator.construct(tmp_ptr + tmp_i, value);
+                this->_allocator.construct(tmp_ptr + tmp_i, copy);
 
             for (; i <  _size; i++, tmp_i++)
-                this->_allocator.construct(tmp_ptr + tmp_i, _ptr[i]);
+                ft::relocate(_allocator, tmp_ptr + tmp_i, _ptr[i]);
             for(size_type j = 0; j < _size; j++)
                 this->_allocator.destroy(_ptr + j);
             _size += count;
-            _allocator.deallocate(_ptr, old_cap);
+            deallocate_buffer(_ptr, old_cap);
             _ptr = tmp_ptr;
             return iterator(_ptr + dist);
         }
@@ -318,53 +367,8 @@ namespace ft
         iterator insert( const_iterator pos, InputIt first, InputIt last,
                         typename enable_if <!is_integral<InputIt>::value, bool>::type = 0)
         {
-            size_type old_cap = _capacity;
             size_type pos_index = (size_type)ft::distance(const_iterator(begin()), pos);
-            size_type dist = (size_type)ft::distance(first, last);
-            T* tmp_ptr;
-            if (dist + _size > _capacity)
-                _capacity = dist + _size;
-            try
-            {
-                tmp_ptr = this->_allocator.allocate(_capacity);
-            }
-            catch(...)
-            {
-                for(size_type j = 0; j < _size; j++)
-                    this->_allocator.destroy(_ptr + j);
-                _allocator.deallocate(_ptr, old_cap);
-                _ptr = NULL;
-                _capacity = 0;
-                _size = 0;
-                throw;
-            }
-            size_type i = 0, tmp_i = 0;
-            for (; i < pos_index; tmp_i++, i++)
-                this->_allocator.construct(tmp_ptr + tmp_i, _ptr[i]);
-            try{
-            for (; first != last; tmp_i++, first++)
-                this->_allocator.construct(tmp_ptr + tmp_i, *first);
-            }
-            catch(...) 
-            {
-                for (size_type k = 0; k < tmp_i; k++)
-                    this->_allocator.destroy(tmp_ptr + k);
-                this->_allocator.deallocate(tmp_ptr, _capacity);
-                for(size_type j = 0; j < _size; j++)
-                this->_allocator.destroy(_ptr + j);
-                 _allocator.deallocate(_ptr, old_cap);
-                 _size = 0 ;
-                 _capacity = 0;
-                 throw;
-            }
-            for (; i <  _size; i++, tmp_i++)
-                this->_allocator.construct(tmp_ptr + tmp_i, _ptr[i]);
-            for(size_type j = 0; j < _size; j++)
-                this->_allocator.destroy(_ptr + j);
-            _size += dist;
-            _allocator.deallocate(_ptr, old_cap);
-            _ptr = tmp_ptr;
-            return iterator(_ptr + dist);
+            return insert_range(pos_index, first, last, ft::pass_category(typename ft::iterator_traits<InputIt>::iterator_category()));
         }
 
         iterator erase( iterator pos )
@@ -374,20 +378,26 @@ namespace ft
 
         iterator erase(iterator first, iterator last)
         {
-            size_type i = 0, m = 0;
-            while((_ptr + i) != first.base())
-                i++;
-            int j = i;
-            m = i;
+            if (first == last)
+                return first;
+            size_type i = first.base() - _ptr;
+            size_type j = i;
+            size_type m = i;
             while (first != last)
             {
                 _allocator.destroy(_ptr + i);
                 ++first;
                 i++;
             }
+            if (is_trivially_relocatable<T>::value)
+            {
+                move_bytes(_ptr + j, _ptr + i, _size - i);
+                _size = j + (_size - i);
+                return (iterator(_ptr + m));
+            }
             while (i < _size)
             {
-                _allocator.construct(_ptr + j, _ptr[i]);
+                ft::relocate(_allocator, _ptr + j, _ptr[i]);
                 _allocator.destroy(_ptr + i);
                 i++;
                 j++;
@@ -402,10 +412,14 @@ namespace ft
             {   
                 if(_size == _capacity )
                 {
-                    size_t tmp = (_capacity == 0) ? 1 : _capacity * 2;
-                    reserve(tmp);
+                    // value may be an element: copy it before reserve()
+                    // releases the old storage.
+                    T copy(value);
+                    reserve(recommend(_size + 1));
+                    ft::relocate(_allocator, _ptr + _size, copy);
                 }
-                _allocator.construct(_ptr + _size, value);
+                else
+                    _allocator.construct(_ptr + _size, value);
                 _size++;
 
             }
@@ -420,10 +434,75 @@ namespace ft
             
         }
 
+#if __cplusplus >= 201103L
+        void push_back( T&& value )
+        {
+            emplace_back(std::move(value));
+        }
+
+        // args may refer to an element of this vector, so on reallocation
+        // the new element is built before the old storage goes away.
+        template< class... Args >
+        reference emplace_back( Args&&... args )
+        {
+            if (_size == _capacity)
+            {
+                T tmp(std::forward<Args>(args)...);
+                reserve(recommend(_size + 1));
+                std::allocator_traits<Allocator>::construct(_allocator, _ptr + _size, std::move(tmp));
+            }
+            else
+                std::allocator_traits<Allocator>::construct(_allocator, _ptr + _size,
+                    std::forward<Args>(args)...);
+            return _ptr[_size++];
+        }
+
+        template< class... Args >
+        iterator emplace( const_iterator pos, Args&&... args )
+        {
+            size_type index = (size_type)ft::distance(const_iterator(begin()), pos);
+            if (index == _size)
+            {
+                emplace_back(std::forward<Args>(args)...);
+                return iterator(_ptr + index);
+            }
+            T tmp(std::forward<Args>(args)...);
+            if (is_trivially_relocatable<T>::value)
+            {
+                size_type new_cap = _size == _capacity ? recommend(_size + 1) : _capacity;
+                pointer buf = open_gap(index, 1, new_cap);
+                try
+                {
+                    std::allocator_traits<Allocator>::construct(_allocator, buf + index, std::move(tmp));
+                }
+                catch(...)
+                {
+                    abort_gap(buf, index, 1, new_cap);
+                    throw;
+                }
+                commit_gap(buf, 1, new_cap);
+                return iterator(_ptr + index);
+            }
+            if (_size == _capacity)
+                reserve(recommend(_size + 1));
+            std::allocator_traits<Allocator>::construct(_allocator, _ptr + _size, std::move(_ptr[_size - 1]));
+            _size++;
+            for (size_type i = _size - 2; i > index; i--)
+                _ptr[i] = std::move(_ptr[i - 1]);
+            _ptr[index] = std::move(tmp);
+            return iterator(_ptr + index);
+        }
+
+        iterator insert( const_iterator pos, T&& value )
+        {
+            return emplace(pos, std::move(value));
+        }
+#endif
+
         void pop_back()
         {
-            _allocator.destroy(_ptr + _size);
             _size--;
+            _allocator.destroy(_ptr + _size);
         }
 
         void resize( size_type count, T value = T() )
@@ -432,8 +511,11 @@ namespace ft
                 while (_size != count)
                     pop_back();
             else if (count > _size)
-                while (_size != count)
-                    push_back(value);
+            {
+                reserve(count);
+                for (; _size != count; _size++)
+                    _allocator.construct(_ptr + _size, value);
+            }
         }
 
         void reserve( size_type new_cap )
@@ -441,29 +523,36 @@ namespace ft
                 pointer temp_arr = NULL;
 				size_type temp_size = 0;
 
-				if (this->_capacity == this->max_size() || new_cap > this->max_size())
-					 std::length_error(std::string("vector::reserve() - Not enough memory"));
+				if (new_cap > this->max_size())
+					throw std::length_error(std::string("vector::reserve() - Not enough memory"));
 				if (new_cap > this->_capacity)
 				{
+					if (is_trivially_relocatable<T>::value)
+					{
+						this->_ptr = grow_buffer(new_cap, allocator_can_reallocate<Allocator>());
+						this->_capacity = new_cap;
+						return;
+					}
+					note_reallocation();
 					try
 					{
-						temp_arr = this->_allocator.allocate(new_cap);
+						temp_arr = allocate_buffer(new_cap);
 						for(temp_size = 0; temp_size < this->_size; ++temp_size)
-							this->_allocator.construct(temp_arr + temp_size, this->_ptr[temp_size]);
+							ft::relocate(_allocator, temp_arr + temp_size, this->_ptr[temp_size]);
 					}
 					catch(...)
 					{
 						for(size_type i = 0; i < temp_size; ++i)
 							this->_allocator.destroy(temp_arr + i);
-						this->_allocator.deallocate(temp_arr, new_cap);
+						deallocate_buffer(temp_arr, new_cap);
                         for (size_type k = 0; k < this->_size; ++k)
 						    this->_allocator.destroy(this->_allocator.address(this->_ptr[k]));
-					    this->_allocator.deallocate(this->_ptr, this->_capacity);
+					    deallocate_buffer(this->_ptr, this->_capacity);
                         throw;
 					}
 					for (size_type k = 0; k < this->_size; ++k)
 						this->_allocator.destroy(this->_allocator.address(this->_ptr[k]));
-					this->_allocator.deallocate(this->_ptr, this->_capacity);
+					deallocate_buffer(this->_ptr, this->_capacity);
 					this->_ptr = temp_arr;
 					this->_capacity = new_cap;
 					this->_size = temp_size;
@@ -510,63 +599,256 @@ namespace ft
                 return const_reverse_iterator(begin());
         }
 
-        void swap(vector &other)
+#ifdef FT_STATS
+        const ft::container_stats& stats() const
         {
-            ft::swap(this->_size, other._size);
-            ft::swap(this->_capacity, other._capacity);
-            ft::swap(this->_allocator, other._allocator);
-            ft::swap(this->_ptr, other._ptr);
+            return _stats;
+        }
 
+        void reset_stats()
+        {
+            _stats.reset();
+        }
+#endif
+
+        void swap(vector &other)
+        {
+            std::swap(this->_size, other._size);
+            std::swap(this->_capacity, other._capacity);
+            std::swap(this->_allocator, other._allocator);
+            std::swap(this->_ptr, other._ptr);
         }
 
         private:
-			pointer			_ptr;
-            size_type 		_capacity;
-            size_type 		_size;
-            allocator_type	_allocator;
+            pointer allocate_buffer(size_type n)
+            {
+                pointer p = _allocator.allocate(n);
+                FT_STAT(_stats, allocations, 1);
+                return p;
+            }
 
-    };
+            void deallocate_buffer(pointer p, size_type n)
+            {
+                if (p != NULL)
+                    FT_STAT(_stats, deallocations, 1);
+                _allocator.deallocate(p, n);
+            }
 
-    template <typename T>
-    void swap(vector<T> &v1, vector<T> &v2)
-    {
-        v1.swap(v2);
-    }
+            // Counts moving the current elements to a new, larger buffer.
+            void note_reallocation()
+            {
+#ifdef FT_STATS
+                if (_ptr != NULL)
+                {
+                    FT_STAT(_stats, reallocations, 1);
+                    FT_STAT(_stats, bytes_copied, _size * sizeof(T));
+                }
+#endif
+            }
 
-    template <typename T>
-    bool operator<(const vector<T> &lhs, const vector<T> &rhs)
-    {
-        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
-    }
+            // Appends [first, last) to the cleared vector, allocating once
+            // when the range can be measured without consuming it.
+            template< class InputIt >
+            void assign_range(InputIt first, InputIt last, ft::input_iterator_tag)
+            {
+                for (; first != last; ++first)
+                    this->push_back(*first);
+            }
 
-    template <typename T>
-    bool operator>(const vector<T> &lhs, const vector<T> &rhs) 
-    {
-        return rhs < lhs;
-    }
+            template< class ForwardIt >
+            void assign_range(ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
+            {
+                reserve((size_type)ft::distance(first, last));
+                assign_range(first, last, ft::input_iterator_tag());
+            }
 
-    template <typename T>
-    bool operator>=(const vector<T> &lhs, const vector<T> &rhs)
-    {
-       return !(lhs < rhs);
-    }
+            // Inserts [first, last) at pos_index. A single-pass range is
+            // pushed at the end, then rotated into place.
+            template< class InputIt >
+            iterator insert_range(size_type pos_index, InputIt first, InputIt last, ft::input_iterator_tag)
+            {
+                size_type old_size = _size;
+                try
+                {
+                    for (; first != last; ++first)
+                        push_back(*first);
+                }
+                catch(...)
+                {
+                    while (_size > old_size)
+                        pop_back();
+                    throw;
+                }
+                std::rotate(_ptr + pos_index, _ptr + old_size, _ptr + _size);
+                return iterator(_ptr + pos_index);
+            }
 
-    template <typename T>
-    bool operator<=(const vector<T> &lhs, const vector<T> &rhs)
-    {
-        return !(lhs > rhs);
-    }
+            template< class ForwardIt >
+            iterator insert_range(size_type pos_index, ForwardIt first, ForwardIt last, ft::forward_iterator_tag)
+            {
+                size_type old_cap = _capacity;
+                size_type dist = (size_type)ft::distance(first, last);
+                if (is_trivially_relocatable<T>::value && dist != 0)
+                {
+                    size_type new_cap = dist + _size > _capacity ? dist + _size : _capacity;
+                    pointer buf = open_gap(pos_index, dist, new_cap);
+                    size_type i = 0;
+                    try
+                    {
+                        for (; first != last; i++, first++)
+                            _allocator.construct(buf + pos_index + i, *first);
+                    }
+                    catch(...)
+                    {
+                        for (size_type j = 0; j < i; j++)
+                            _allocator.destroy(buf + pos_index + j);
+                        abort_gap(buf, pos_index, dist, new_cap);
+                        throw;
+                    }
+                    commit_gap(buf, dist, new_cap);
+                    return iterator(_ptr + pos_index);
+                }
+                T* tmp_ptr;
+                if (dist + _size > _capacity)
+                    _capacity = dist + _size;
+                try
+                {
+                    tmp_ptr = allocate_buffer(_capacity);
+                    note_reallocation();
+                }
+                catch(...)
+                {
+                    for(size_type j = 0; j < _size; j++)
+                        this->_allocator.destroy(_ptr + j);
+                    deallocate_buffer(_ptr, old_cap);
+                    _ptr = NULL;
+                    _capacity = 0;
+                    _size = 0;
+                    throw;
+                }
+                size_type i = 0, tmp_i = 0;
+                for (; i < pos_index; tmp_i++, i++)
+                    ft::relocate(_allocator, tmp_ptr + tmp_i, _ptr[i]);
+                try{
+                for (; first != last; tmp_i++, first++)
+                    this->_allocator.construct(tmp_ptr + tmp_i, *first);
+                }
+                catch(...) 
+                {
+                    for (size_type k = 0; k < tmp_i; k++)
+                        this->_allocator.destroy(tmp_ptr + k);
+                    deallocate_buffer(tmp_ptr, _capacity);
+                    for(size_type j = 0; j < _size; j++)
+                    this->_allocator.destroy(_ptr + j);
+                     deallocate_buffer(_ptr, old_cap);
+                     _size = 0 ;
+                     _capacity = 0;
+                     throw;
+                }
+                for (; i <  _size; i++, tmp_i++)
+                    ft::relocate(_allocator, tmp_ptr + tmp_i, _ptr[i]);
+                for(size_type j = 0; j < _size; j++)
+                    this->_allocator.destroy(_ptr + j);
+                _size += dist;
+                deallocate_buffer(_ptr, old_cap);
+                _ptr = tmp_ptr;
+                return iterator(_ptr + pos_index);
+            }
 
-    template <typename T>
-    bool operator==(const vector<T> &lhs, const vector<T> &rhs)
-    {
-        return ft::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
-    }
+            // Capacity to grow to when at least required elements must fit.
+            size_type recommend(size_type required) const
+            {
+                return ft::recommend_capacity<Growth>(_capacity, required, sizeof(T), max_size());
+            }
+
+            static void copy_bytes(pointer dst, const_pointer src, size_type n)
+            {
+                if (n != 0)
+                    std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+            }
+
+            static void move_bytes(pointer dst, const_pointer src, size_type n)
+            {
+                if (n != 0)
+                    std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+            }
+
+            // Trivially relocatable T only: moves the elements into a buffer
+            // of new_cap elements, resized in place when the allocator can.
+            // Growing in place counts as neither allocation nor
+            // reallocation; a block that moved counts as one reallocation.
+            pointer grow_buffer(size_type new_cap, true_type)
+            {
+                pointer buf = _allocator.reallocate(_ptr, _capacity, new_cap);
+                if (_ptr == NULL)
+                    FT_STAT(_stats, allocations, 1);
+                else if (buf != _ptr)
+                    note_reallocation();
+                return buf;
+            }
 
-    template <typename T>
-    bool operator!=(const vector<T> &lhs, const vector<T> &rhs)
+            pointer grow_buffer(size_type new_cap, false_type)
+            {
+                note_reallocation();
+                pointer buf = allocate_buffer(new_cap);
+                copy_bytes(buf, _ptr, _size);
+                deallocate_buffer(_ptr, _capacity);
+                return buf;
+            }
+
+            // Trivially relocatable T only: makes room for count elements at
+            // index pos by moving the tail bytes, into a new buffer of
+            // new_cap elements when that differs from the capacity. The old
+            // buffer is left intact until commit_gap(), so abort_gap() can
+            // undo the move.
+            pointer open_gap(size_type pos, size_type count, size_type new_cap)
+            {
+                pointer buf = _ptr;
+                if (new_cap != _capacity)
+                {
+                    buf = allocate_buffer(new_cap);
+                    note_reallocation();
+                    copy_bytes(buf, _ptr, pos);
+                    copy_bytes(buf + pos + count, _ptr + pos, _size - pos);
+                }
+                else
+                    move_bytes(_ptr + pos + count, _ptr + pos, _size - pos);
+                return buf;
+            }
+
+            void commit_gap(pointer buf, size_type count, size_type new_cap)
+            {
+                if (buf != _ptr)
+                {
+                    deallocate_buffer(_ptr, _capacity);
+                    _ptr = buf;
+                    _capacity = new_cap;
+                }
+                _size += count;
+            }
+
+            void abort_gap(pointer buf, size_type pos, size_type count, size_type new_cap)
+            {
+                if (buf != _ptr)
+                    deallocate_buffer(buf, new_cap);
+                else
+                    move_bytes(_ptr + pos, _ptr + pos + count, _size - pos);
+            }
+
+			pointer			_ptr;
+            size_type 		_capacity;
+            size_type 		_size;
+            allocator_type	_allocator;
+#ifdef FT_STATS
+            ft::container_stats _stats;
+#endif
+
+    };
+
+    template <class T, class Alloc, class Growth>
+    void swap(vector<T, Alloc, Growth> &v1, vector<T, Alloc, Growth> &v2)
     {
-        return !(lhs == rhs);
+        v1.swap(v2);
     }
 
 }